@@ -0,0 +1,467 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <time.h>
+#include <unistd.h>
+#include "../include/engine.h"
+#include "../include/engine/ensemble.h"
+
+#define OPTIONS "d:D:e:f:k:r:s:S:t:T:"
+
+#define VALUE_MAX 16
+
+typedef enum {
+    FORMAT_CSV = 0,
+    FORMAT_JSON,
+} format_e;
+
+typedef struct {
+    double value[VALUE_MAX];
+    size_t count;
+} list_t;
+
+typedef struct {
+    format_e format;
+    double duration;
+    const char *rule;
+    list_t density;
+    list_t depth;
+    list_t kernel;
+    list_t seed;
+    list_t size;
+    list_t thread;
+    list_t universe;
+    size_t runs;
+} bench_t;
+
+static const double DENSITY[] = { 0.5, 0.25, 0.05 };
+static const double DEPTH[] = { 1 };
+static const double SEED[] = { 1, 2 };
+static const double SIZE[] = { 256, 1024, 4096, 16384 };
+
+static void
+usage(
+    const char *name
+    )
+{
+    fprintf(stderr, "Usage: %s [-f csv|json] [-T SECONDS] [-s SIZE]... [-d DENSITY]... [-S SEED]... [-t THREADS]..."
+        " [-D DEPTH]... [-e UNIVERSES]... [-k KERNEL]... [-r RULE]\n", name);
+}
+
+static double
+elapsed(
+    const struct timespec *begin
+    )
+{
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    return (end.tv_sec - begin->tv_sec) + ((end.tv_nsec - begin->tv_nsec) / 1e9);
+}
+
+static int
+append(
+    list_t *list,
+    double value
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    if(list->count == VALUE_MAX) {
+        result = EXIT_FAILURE;
+        goto exit;
+    }
+
+    list->value[list->count++] = value;
+
+exit:
+    return result;
+}
+
+static void
+defaults(
+    list_t *list,
+    const double *value,
+    size_t count
+    )
+{
+
+    if(!list->count) {
+
+        for(size_t index = 0; index < count; ++index) {
+            append(list, value[index]);
+        }
+    }
+}
+
+static uint64_t
+random_next(
+    uint64_t *state
+    )
+{
+    uint64_t result = (*state += UINT64_C(0x9E3779B97F4A7C15));
+
+    result = (result ^ (result >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    result = (result ^ (result >> 27)) * UINT64_C(0x94D049BB133111EB);
+
+    return result ^ (result >> 31);
+}
+
+static void
+fill(
+    gol_dense_t *dense,
+    double density,
+    uint64_t seed
+    )
+{
+    uint64_t state = seed, threshold = density * (double)UINT32_MAX;
+
+    for(size_t y = 0; y < dense->height; ++y) {
+        uint64_t *row = &dense->previous[y * dense->stride];
+
+        for(size_t x = 0; x < dense->width; ++x) {
+
+            if((random_next(&state) >> 32) < threshold) {
+                row[x / WORD_BITS] |= UINT64_C(1) << (x & (WORD_BITS - 1));
+            } else {
+                row[x / WORD_BITS] &= ~(UINT64_C(1) << (x & (WORD_BITS - 1)));
+            }
+        }
+    }
+}
+
+static int
+run(
+    bench_t *bench,
+    gol_kernel_e kernel,
+    size_t size,
+    double density,
+    uint64_t seed,
+    unsigned long threads,
+    unsigned long depth
+    )
+{
+    int result;
+    double seconds;
+    struct timespec begin;
+    uint64_t generations, start;
+    gol_engine_t engine = {};
+    char rule[RULE_LENGTH];
+    gol_config_t config = { .width = size, .height = size, .threads = threads, .rule = bench->rule, .depth = depth };
+
+    if((result = gol_engine_init(&engine, &config)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    engine.dense.kernel = gol_kernel(kernel, &engine.dense.rule);
+    gol_rule_name(&engine.dense.rule, rule, sizeof(rule));
+    fill(&engine.dense, density, seed);
+
+    if((result = gol_engine_step(&engine)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    start = engine.generation;
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+
+    do {
+
+        if((result = gol_engine_step(&engine)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+    } while((seconds = elapsed(&begin)) < bench->duration);
+
+    generations = engine.generation - start;
+
+    if(bench->format == FORMAT_JSON) {
+        fprintf(stdout, "%s\n    {\"engine\": \"dense\", \"kernel\": \"%s\", \"rule\": \"%s\", \"width\": %zu, "
+            "\"height\": %zu, \"density\": %g, \"seed\": %lu, \"threads\": %zu, \"depth\": %zu, \"generations\": %lu, "
+            "\"seconds\": %.6f, \"generations_per_second\": %.3f, \"cells_per_second\": %.0f, \"ns_per_cell\": %.6f, "
+            "\"universes\": 1, \"memory\": \"%s\"}", bench->runs ? "," : "", gol_kernel_name(kernel), rule, size, size,
+            density, seed, engine.dense.pool.count, engine.dense.depth, generations, seconds, generations / seconds,
+            (generations * (double)size * size) / seconds, (seconds * 1e9) / (generations * (double)size * size),
+            gol_memory_name(gol_dense_memory(&engine.dense)));
+    } else {
+        fprintf(stdout, "dense,%s,%s,%zu,%zu,%g,%lu,%zu,%zu,%lu,%.6f,%.3f,%.0f,%.6f,1,%s\n", gol_kernel_name(kernel),
+            rule, size, size, density, seed, engine.dense.pool.count, engine.dense.depth, generations, seconds,
+            generations / seconds, (generations * (double)size * size) / seconds,
+            (seconds * 1e9) / (generations * (double)size * size), gol_memory_name(gol_dense_memory(&engine.dense)));
+    }
+
+    fflush(stdout);
+    ++bench->runs;
+
+exit:
+    gol_engine_uninit(&engine);
+
+    return result;
+}
+
+static int
+run_ensemble(
+    bench_t *bench,
+    gol_kernel_e kernel,
+    size_t size,
+    double density,
+    uint64_t seed,
+    unsigned long count
+    )
+{
+    int result;
+    uint64_t *word;
+    double cells, seconds;
+    struct timespec begin;
+    uint64_t generations, start, state = seed, threshold = density * (double)UINT32_MAX;
+    gol_ensemble_t *ensemble = NULL;
+    char rule[RULE_LENGTH];
+    size_t words = (size + WORD_BITS - 1) / WORD_BITS;
+    gol_config_t config = { .width = size, .height = size, .rule = bench->rule };
+
+    if(!(word = calloc(words * size, sizeof(uint64_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if((result = gol_ensemble_create(&ensemble, &config, count)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    ensemble->kernel = gol_kernel_ensemble(kernel);
+    gol_rule_name(&ensemble->rule, rule, sizeof(rule));
+
+    for(unsigned long index = 0; index < count; ++index) {
+        memset(word, 0, words * size * sizeof(uint64_t));
+
+        for(size_t y = 0; y < size; ++y) {
+
+            for(size_t x = 0; x < size; ++x) {
+
+                if((random_next(&state) >> 32) < threshold) {
+                    word[(y * words) + (x / WORD_BITS)] |= UINT64_C(1) << (x & (WORD_BITS - 1));
+                }
+            }
+        }
+
+        if((result = gol_ensemble_set(ensemble, index, word, words)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+    }
+
+    gol_ensemble_step(ensemble, 1);
+    start = ensemble->generation;
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+
+    do {
+        gol_ensemble_step(ensemble, 1);
+    } while((seconds = elapsed(&begin)) < bench->duration);
+
+    generations = ensemble->generation - start;
+    cells = generations * (double)size * size * count;
+
+    if(bench->format == FORMAT_JSON) {
+        fprintf(stdout, "%s\n    {\"engine\": \"ensemble\", \"kernel\": \"%s\", \"rule\": \"%s\", \"width\": %zu, "
+            "\"height\": %zu, \"density\": %g, \"seed\": %lu, \"threads\": 1, \"depth\": 1, \"generations\": %lu, "
+            "\"seconds\": %.6f, \"generations_per_second\": %.3f, \"cells_per_second\": %.0f, \"ns_per_cell\": %.6f, "
+            "\"universes\": %lu, \"memory\": \"%s\"}", bench->runs ? "," : "", gol_kernel_name(kernel), rule, size, size,
+            density, seed, generations, seconds, generations / seconds, cells / seconds, (seconds * 1e9) / cells, count,
+            gol_memory_name(GOL_MEMORY_HEAP));
+    } else {
+        fprintf(stdout, "ensemble,%s,%s,%zu,%zu,%g,%lu,1,1,%lu,%.6f,%.3f,%.0f,%.6f,%lu,%s\n", gol_kernel_name(kernel),
+            rule, size, size, density, seed, generations, seconds, generations / seconds, cells / seconds,
+            (seconds * 1e9) / cells, count, gol_memory_name(GOL_MEMORY_HEAP));
+    }
+
+    fflush(stdout);
+    ++bench->runs;
+
+exit:
+    gol_ensemble_destroy(ensemble);
+    free(word);
+
+    return result;
+}
+
+int
+main(
+    int argc,
+    char *argv[]
+    )
+{
+    gol_rule_t rule = {};
+    int option, result = EXIT_SUCCESS;
+    bench_t bench = { .duration = 0.25 };
+
+    while((option = getopt(argc, argv, OPTIONS)) != -1) {
+        list_t *list = NULL;
+        double value = 0;
+
+        switch(option) {
+            case 'd':
+                list = &bench.density;
+                value = strtod(optarg, NULL);
+                break;
+            case 'D':
+                list = &bench.depth;
+                value = strtoul(optarg, NULL, 10);
+                break;
+            case 'e':
+                list = &bench.universe;
+                value = strtoul(optarg, NULL, 10);
+                break;
+            case 'f':
+
+                if(!strcmp(optarg, "csv")) {
+                    bench.format = FORMAT_CSV;
+                } else if(!strcmp(optarg, "json")) {
+                    bench.format = FORMAT_JSON;
+                } else {
+                    usage(argv[0]);
+                    result = EXIT_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 'k':
+                list = &bench.kernel;
+
+                for(value = GOL_KERNEL_SCALAR; value < GOL_KERNEL_MAX; ++value) {
+
+                    if(!strcmp(optarg, gol_kernel_name(value))) {
+                        break;
+                    }
+                }
+
+                if(value == GOL_KERNEL_MAX) {
+                    usage(argv[0]);
+                    result = EXIT_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 'r':
+                bench.rule = optarg;
+                break;
+            case 's':
+                list = &bench.size;
+                value = strtoul(optarg, NULL, 10);
+                break;
+            case 'S':
+                list = &bench.seed;
+                value = strtoull(optarg, NULL, 10);
+                break;
+            case 't':
+                list = &bench.thread;
+                value = strtoul(optarg, NULL, 10);
+                break;
+            case 'T':
+                bench.duration = strtod(optarg, NULL);
+                break;
+            default:
+                usage(argv[0]);
+                result = EXIT_FAILURE;
+                goto exit;
+        }
+
+        if(list && (append(list, value) != EXIT_SUCCESS)) {
+            usage(argv[0]);
+            result = EXIT_FAILURE;
+            goto exit;
+        }
+    }
+
+    defaults(&bench.density, DENSITY, sizeof(DENSITY) / sizeof(*DENSITY));
+    defaults(&bench.depth, DEPTH, sizeof(DEPTH) / sizeof(*DEPTH));
+    defaults(&bench.seed, SEED, sizeof(SEED) / sizeof(*SEED));
+    defaults(&bench.size, SIZE, sizeof(SIZE) / sizeof(*SIZE));
+
+    if(!bench.kernel.count) {
+
+        for(gol_kernel_e kernel = GOL_KERNEL_SCALAR; kernel < GOL_KERNEL_MAX; ++kernel) {
+            append(&bench.kernel, kernel);
+        }
+    }
+
+    if(!bench.thread.count) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+
+        for(long threads = 1; threads < online; threads *= 2) {
+            append(&bench.thread, threads);
+        }
+
+        append(&bench.thread, (online > 0) ? online : 1);
+    }
+
+    if(bench.format == FORMAT_JSON) {
+        fprintf(stdout, "[");
+    } else {
+        fprintf(stdout, "engine,kernel,rule,width,height,density,seed,threads,depth,generations,seconds,generations_per_second,"
+            "cells_per_second,ns_per_cell,universes,memory\n");
+    }
+
+    for(size_t kernel = 0; kernel < bench.kernel.count; ++kernel) {
+
+        if(!gol_kernel(bench.kernel.value[kernel], &rule)) {
+            continue;
+        }
+
+        for(size_t size = 0; size < bench.size.count; ++size) {
+
+            for(size_t density = 0; density < bench.density.count; ++density) {
+
+                for(size_t seed = 0; seed < bench.seed.count; ++seed) {
+
+                    if(bench.universe.count) {
+
+                        for(size_t universe = 0; universe < bench.universe.count; ++universe) {
+
+                            if((result = run_ensemble(&bench, bench.kernel.value[kernel], bench.size.value[size],
+                                    bench.density.value[density], bench.seed.value[seed],
+                                    bench.universe.value[universe])) != EXIT_SUCCESS) {
+                                fprintf(stderr, "ERR: %s\n", gol_error());
+                                goto exit;
+                            }
+                        }
+                    } else {
+
+                        for(size_t thread = 0; thread < bench.thread.count; ++thread) {
+
+                            for(size_t depth = 0; depth < bench.depth.count; ++depth) {
+
+                                if((result = run(&bench, bench.kernel.value[kernel], bench.size.value[size],
+                                        bench.density.value[density], bench.seed.value[seed],
+                                        bench.thread.value[thread], bench.depth.value[depth])) != EXIT_SUCCESS) {
+                                    fprintf(stderr, "ERR: %s\n", gol_error());
+                                    goto exit;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if(bench.format == FORMAT_JSON) {
+        fprintf(stdout, "\n]\n");
+    }
+
+exit:
+    return result;
+}
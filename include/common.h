@@ -22,6 +22,13 @@
 #ifndef GOL_COMMON_H_
 #define GOL_COMMON_H_
 
+#include "./common/bits.h"
+#include "./common/buffer.h"
+#include "./common/cycle.h"
 #include "./common/error.h"
+#include "./common/memory.h"
+#include "./common/mipmap.h"
+#include "./common/pool.h"
+#include "./common/random.h"
 
 #endif /* GOL_COMMON_H_ */
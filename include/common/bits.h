@@ -0,0 +1,76 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GOL_BITS_H_
+#define GOL_BITS_H_
+
+#include "./define.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef void (*gol_bits_churn_t)(
+    __in const uint64_t *previous,
+    __in const uint64_t *next,
+    __in size_t count,
+    __in uint64_t mask,
+    __inout uint64_t *births,
+    __inout uint64_t *deaths
+    );
+
+gol_bits_churn_t gol_bits_churn(void);
+
+void gol_bits_copy(
+    __inout uint64_t *word,
+    __in size_t offset,
+    __in const uint64_t *source,
+    __in size_t source_offset,
+    __in size_t count
+    );
+
+void gol_bits_fill(
+    __inout uint64_t *word,
+    __in size_t offset,
+    __in size_t count,
+    __in bool value
+    );
+
+uint64_t gol_bits_hash(
+    __in const uint64_t *word,
+    __in size_t count,
+    __in uint64_t mask,
+    __in uint64_t position
+    );
+
+uint64_t gol_bits_rehash(
+    __in const uint64_t *previous,
+    __in const uint64_t *next,
+    __in size_t count,
+    __in uint64_t mask,
+    __in uint64_t position
+    );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_BITS_H_ */
@@ -0,0 +1,91 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GOL_BUFFER_H_
+#define GOL_BUFFER_H_
+
+#include "./define.h"
+
+#define BUFFER_BAND 32
+#define BUFFER_FRESH 4
+#define BUFFER_SLOTS 3
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    uint32_t begin;
+    uint32_t end;
+} gol_buffer_span_t;
+
+typedef struct {
+    uint64_t generation;
+    uint64_t *word;
+    gol_buffer_span_t *span;
+} gol_buffer_slot_t;
+
+typedef struct {
+    size_t size;
+    size_t stride;
+    size_t height;
+    size_t bands;
+    uint32_t previous;
+    uint32_t back;
+    uint32_t front;
+    uint32_t middle;
+    gol_buffer_slot_t slot[BUFFER_SLOTS];
+} gol_buffer_t;
+
+gol_buffer_slot_t *gol_buffer_acquire(
+    __inout gol_buffer_t *buffer
+    );
+
+const gol_buffer_slot_t *gol_buffer_consume(
+    __inout gol_buffer_t *buffer
+    );
+
+int gol_buffer_init(
+    __inout gol_buffer_t *buffer,
+    __in size_t stride,
+    __in size_t height
+    );
+
+void gol_buffer_publish(
+    __inout gol_buffer_t *buffer,
+    __in uint64_t generation
+    );
+
+void gol_buffer_uninit(
+    __inout gol_buffer_t *buffer
+    );
+
+void gol_buffer_write(
+    __inout gol_buffer_t *buffer,
+    __inout gol_buffer_slot_t *slot,
+    __in const uint64_t *frame
+    );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_BUFFER_H_ */
@@ -0,0 +1,63 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GOL_CYCLE_H_
+#define GOL_CYCLE_H_
+
+#include "./define.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    size_t limit;
+    size_t count;
+    uint64_t *hash;
+    uint64_t *generation;
+    uint64_t period;
+    uint64_t since;
+} gol_cycle_t;
+
+int gol_cycle_init(
+    __inout gol_cycle_t *cycle,
+    __in size_t limit
+    );
+
+bool gol_cycle_push(
+    __inout gol_cycle_t *cycle,
+    __in uint64_t hash,
+    __in uint64_t generation
+    );
+
+void gol_cycle_reset(
+    __inout gol_cycle_t *cycle
+    );
+
+void gol_cycle_uninit(
+    __inout gol_cycle_t *cycle
+    );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_CYCLE_H_ */
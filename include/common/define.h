@@ -48,4 +48,6 @@
 
 #define SCALE 1
 
+#define WORD_BITS 64
+
 #endif /* GOL_DEFINE_H_ */
@@ -31,8 +31,21 @@ extern "C" {
 #define GOL_ERROR(_ERR_) \
     gol_error_set(_ERR_, __FILE__, __FUNCTION__, __LINE__)
 
+typedef struct {
+    int error;
+    char str[64];
+} gol_error_t;
+
 const char *gol_error(void);
 
+void gol_error_restore(
+    __in const gol_error_t *error
+    );
+
+void gol_error_save(
+    __out gol_error_t *error
+    );
+
 int gol_error_set(
     __in int error,
     __in const char *file,
@@ -0,0 +1,74 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Grid allocator, returning cache line aligned, zeroed buffers. Buffers of at least a huge page are mapped from
+ * explicit huge pages when the system reserves them, else huge page aligned and advised for transparent huge pages.
+ * A colour offsets the buffer from that alignment, so buffers walked in step do not share cache sets.
+ */
+
+#ifndef GOL_MEMORY_H_
+#define GOL_MEMORY_H_
+
+#include "./define.h"
+
+#define MEMORY_COLOUR (37 * MEMORY_LINE)
+#define MEMORY_HUGE (UINT64_C(1) << 21)
+#define MEMORY_LINE 64
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef enum {
+    GOL_MEMORY_HEAP = 0,
+    GOL_MEMORY_PAGES,
+    GOL_MEMORY_TRANSPARENT,
+    GOL_MEMORY_HUGETLB,
+    GOL_MEMORY_MAX,
+} gol_memory_e;
+
+typedef struct {
+    void *data;
+    void *base;
+    size_t size;
+    gol_memory_e mode;
+} gol_memory_t;
+
+int gol_memory_allocate(
+    __out gol_memory_t *memory,
+    __in size_t size,
+    __in size_t colour
+    );
+
+void gol_memory_free(
+    __inout gol_memory_t *memory
+    );
+
+const char *gol_memory_name(
+    __in gol_memory_e mode
+    );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_MEMORY_H_ */
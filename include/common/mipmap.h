@@ -0,0 +1,76 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GOL_MIPMAP_H_
+#define GOL_MIPMAP_H_
+
+#include "./define.h"
+
+#define MIPMAP_BASE 3
+#define MIPMAP_LEVELS 64
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    size_t width;
+    size_t height;
+    uint32_t top;
+    size_t level_width[MIPMAP_LEVELS];
+    size_t level_height[MIPMAP_LEVELS];
+    uint8_t *density[MIPMAP_LEVELS];
+} gol_mipmap_t;
+
+uint8_t gol_mipmap_density(
+    __in const gol_mipmap_t *mipmap,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in uint32_t level,
+    __in size_t x,
+    __in size_t y
+    );
+
+int gol_mipmap_init(
+    __inout gol_mipmap_t *mipmap,
+    __in size_t width,
+    __in size_t height
+    );
+
+void gol_mipmap_uninit(
+    __inout gol_mipmap_t *mipmap
+    );
+
+void gol_mipmap_update(
+    __inout gol_mipmap_t *mipmap,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t x,
+    __in size_t y,
+    __in size_t width,
+    __in size_t height
+    );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_MIPMAP_H_ */
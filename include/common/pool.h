@@ -0,0 +1,84 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GOL_POOL_H_
+#define GOL_POOL_H_
+
+#include <pthread.h>
+#include "./define.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef void (*gol_pool_task_t)(
+    __in void *context,
+    __in size_t index,
+    __in size_t count
+    );
+
+typedef struct {
+    uint64_t births;
+    uint64_t deaths;
+    uint64_t tiles;
+    uint64_t digest;
+    uint64_t padding[4];
+} gol_pool_counter_t;
+
+typedef struct {
+    size_t count;
+    size_t pending;
+    uint64_t generation;
+    bool exit;
+    gol_pool_task_t task;
+    void *context;
+    pthread_t *thread;
+    gol_pool_counter_t *counter;
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+} gol_pool_t;
+
+void gol_pool_counters(
+    __in const gol_pool_t *pool,
+    __out gol_pool_counter_t *total
+    );
+
+int gol_pool_init(
+    __inout gol_pool_t *pool,
+    __in size_t count
+    );
+
+void gol_pool_run(
+    __inout gol_pool_t *pool,
+    __in gol_pool_task_t task,
+    __in void *context
+    );
+
+void gol_pool_uninit(
+    __inout gol_pool_t *pool
+    );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_POOL_H_ */
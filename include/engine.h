@@ -0,0 +1,126 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GOL_ENGINE_H_
+#define GOL_ENGINE_H_
+
+#include "./engine/dense.h"
+#include "./engine/hashlife.h"
+#include "./engine/sparse.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    gol_engine_e type;
+    size_t width;
+    size_t height;
+    size_t stride;
+    gol_rule_t rule;
+    uint64_t generation;
+    bool stats;
+    gol_stats_t record;
+    gol_pool_counter_t total;
+    gol_cycle_t cycle;
+    uint64_t origin;
+    uint64_t digest;
+    uint64_t folded;
+    gol_dense_t dense;
+    gol_hashlife_t hashlife;
+    gol_sparse_t sparse;
+} gol_engine_t;
+
+int gol_engine_advance(
+    __inout gol_engine_t *engine,
+    __in uint64_t generations
+    );
+
+const uint64_t *gol_engine_frame(
+    __inout gol_engine_t *engine,
+    __out size_t *stride
+    );
+
+int gol_engine_init(
+    __inout gol_engine_t *engine,
+    __in const gol_config_t *config
+    );
+
+const uint64_t *gol_engine_lend(
+    __inout gol_engine_t *engine,
+    __out size_t *stride,
+    __out bool *lent
+    );
+
+gol_memory_e gol_engine_memory(
+    __in const gol_engine_t *engine
+    );
+
+uint64_t gol_engine_oldest(
+    __in const gol_engine_t *engine
+    );
+
+uint64_t gol_engine_population(
+    __in const gol_engine_t *engine
+    );
+
+const uint64_t *gol_engine_recall(
+    __inout gol_engine_t *engine,
+    __in uint64_t generation,
+    __out size_t *stride
+    );
+
+void gol_engine_release(
+    __inout gol_engine_t *engine
+    );
+
+int gol_engine_rewind(
+    __inout gol_engine_t *engine,
+    __in uint64_t generation
+    );
+
+uint64_t gol_engine_span(
+    __in const gol_engine_t *engine
+    );
+
+int gol_engine_step(
+    __inout gol_engine_t *engine
+    );
+
+void gol_engine_uninit(
+    __inout gol_engine_t *engine
+    );
+
+int gol_engine_write(
+    __inout gol_engine_t *engine,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t x,
+    __in size_t y,
+    __in size_t width,
+    __in size_t height
+    );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_ENGINE_H_ */
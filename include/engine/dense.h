@@ -0,0 +1,149 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GOL_DENSE_H_
+#define GOL_DENSE_H_
+
+#include "../common.h"
+#include "../gol.h"
+#include "../kernel.h"
+#include "../pattern.h"
+#include "../snapshot.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    size_t width;
+    size_t height;
+    size_t stride;
+    size_t words;
+    uint32_t tail;
+    uint64_t mask;
+    gol_rule_t rule;
+    size_t planes;
+    gol_kernel_t kernel;
+    gol_bits_churn_t churn;
+    gol_boundary_e boundary;
+    size_t depth;
+    size_t pass;
+    size_t block;
+    gol_pool_t pool;
+    gol_random_t random;
+    bool seed;
+    bool stats;
+    bool digest;
+    bool verify;
+    bool corrupt;
+    uint64_t generation;
+    size_t tile_columns;
+    size_t tile_rows;
+    uint8_t *active[2];
+    uint64_t *stamp;
+    size_t slots;
+    size_t head;
+    size_t held;
+    gol_memory_t *memory;
+    uint64_t **ring;
+    uint64_t *epoch;
+    uint64_t *previous;
+    uint64_t *next;
+    uint64_t *halo;
+    uint64_t *scratch;
+    gol_memory_t reserve;
+    uint64_t *spare;
+    const uint64_t *lent;
+    gol_snapshot_t snapshot;
+} gol_dense_t;
+
+int gol_dense_init(
+    __inout gol_dense_t *dense,
+    __in const gol_config_t *config,
+    __inout gol_snapshot_t *snapshot
+    );
+
+uint64_t gol_dense_digest(
+    __in const gol_dense_t *dense
+    );
+
+const uint64_t *gol_dense_lend(
+    __inout gol_dense_t *dense
+    );
+
+gol_memory_e gol_dense_memory(
+    __in const gol_dense_t *dense
+    );
+
+uint64_t gol_dense_oldest(
+    __in const gol_dense_t *dense
+    );
+
+uint64_t gol_dense_population(
+    __in const gol_dense_t *dense
+    );
+
+const uint64_t *gol_dense_recall(
+    __in const gol_dense_t *dense,
+    __in uint64_t generation
+    );
+
+void gol_dense_release(
+    __inout gol_dense_t *dense
+    );
+
+void gol_dense_renumber(
+    __inout gol_dense_t *dense,
+    __in uint64_t generation
+    );
+
+int gol_dense_rewind(
+    __inout gol_dense_t *dense,
+    __in uint64_t generation
+    );
+
+int gol_dense_step(
+    __inout gol_dense_t *dense
+    );
+
+void gol_dense_uninit(
+    __inout gol_dense_t *dense
+    );
+
+int gol_dense_verify(
+    __inout gol_dense_t *dense
+    );
+
+void gol_dense_write(
+    __inout gol_dense_t *dense,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t x,
+    __in size_t y,
+    __in size_t width,
+    __in size_t height
+    );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_DENSE_H_ */
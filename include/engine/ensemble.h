@@ -0,0 +1,61 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GOL_ENSEMBLE_H_
+#define GOL_ENSEMBLE_H_
+
+#include "../common.h"
+#include "../gol.h"
+#include "../kernel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+struct gol_ensemble_s {
+    size_t width;
+    size_t height;
+    size_t words;
+    size_t count;
+    size_t lanes;
+    size_t pitch;
+    gol_rule_t rule;
+    gol_kernel_ensemble_t kernel;
+    gol_boundary_e boundary;
+    uint64_t generation;
+    uint64_t period;
+    uint64_t since;
+    uint64_t settled;
+    uint64_t *previous;
+    uint64_t *next;
+    uint64_t *origin;
+    uint64_t *change;
+    uint64_t *done;
+    uint64_t *cycle;
+    uint64_t *stable;
+    gol_error_t error;
+};
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_ENSEMBLE_H_ */
@@ -0,0 +1,105 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GOL_HASHLIFE_H_
+#define GOL_HASHLIFE_H_
+
+#include "../common.h"
+#include "../gol.h"
+#include "../rule.h"
+#include "../pattern.h"
+#include "../snapshot.h"
+
+#define HASHLIFE_LEVEL_MAX 62
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    uint32_t child[4];
+    uint32_t result;
+    uint32_t next;
+    uint64_t population;
+    uint8_t level;
+    uint8_t jump;
+    bool mark;
+} gol_hashlife_node_t;
+
+typedef struct {
+    size_t width;
+    size_t height;
+    size_t stride;
+    uint64_t *frame;
+    gol_rule_t rule;
+    uint32_t jump;
+    uint32_t root;
+    int64_t x;
+    int64_t y;
+    bool failed;
+    size_t count;
+    size_t used;
+    size_t capacity;
+    size_t limit;
+    size_t buckets;
+    uint32_t free;
+    uint32_t *bucket;
+    gol_hashlife_node_t *node;
+    uint32_t empty[HASHLIFE_LEVEL_MAX + 1];
+} gol_hashlife_t;
+
+const uint64_t *gol_hashlife_frame(
+    __inout gol_hashlife_t *hashlife
+    );
+
+int gol_hashlife_init(
+    __inout gol_hashlife_t *hashlife,
+    __in const gol_config_t *config,
+    __inout gol_snapshot_t *snapshot
+    );
+
+uint64_t gol_hashlife_population(
+    __in const gol_hashlife_t *hashlife
+    );
+
+int gol_hashlife_step(
+    __inout gol_hashlife_t *hashlife
+    );
+
+void gol_hashlife_uninit(
+    __inout gol_hashlife_t *hashlife
+    );
+
+int gol_hashlife_write(
+    __inout gol_hashlife_t *hashlife,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t x,
+    __in size_t y,
+    __in size_t width,
+    __in size_t height
+    );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_HASHLIFE_H_ */
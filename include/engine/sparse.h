@@ -0,0 +1,106 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GOL_SPARSE_H_
+#define GOL_SPARSE_H_
+
+#include "../common.h"
+#include "../gol.h"
+#include "../kernel.h"
+#include "../pattern.h"
+#include "../snapshot.h"
+
+#define SPARSE_ROWS WORD_BITS
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct gol_sparse_chunk_s {
+    int32_t x;
+    int32_t y;
+    uint32_t idle;
+    struct gol_sparse_chunk_s *next;
+    struct gol_sparse_chunk_s *neighbour[8];
+    uint64_t word[2][SPARSE_ROWS];
+} gol_sparse_chunk_t;
+
+typedef struct {
+    size_t width;
+    size_t height;
+    size_t stride;
+    uint64_t mask;
+    uint64_t *frame;
+    gol_rule_t rule;
+    gol_kernel_t kernel;
+    gol_bits_churn_t churn;
+    gol_pool_t pool;
+    bool stats;
+    bool digest;
+    uint32_t phase;
+    size_t count;
+    size_t capacity;
+    size_t buckets;
+    gol_sparse_chunk_t **bucket;
+    gol_sparse_chunk_t **chunk;
+} gol_sparse_t;
+
+const uint64_t *gol_sparse_frame(
+    __inout gol_sparse_t *sparse
+    );
+
+int gol_sparse_init(
+    __inout gol_sparse_t *sparse,
+    __in const gol_config_t *config,
+    __inout gol_snapshot_t *snapshot
+    );
+
+uint64_t gol_sparse_digest(
+    __in const gol_sparse_t *sparse
+    );
+
+uint64_t gol_sparse_population(
+    __in const gol_sparse_t *sparse
+    );
+
+int gol_sparse_step(
+    __inout gol_sparse_t *sparse
+    );
+
+void gol_sparse_uninit(
+    __inout gol_sparse_t *sparse
+    );
+
+int gol_sparse_write(
+    __inout gol_sparse_t *sparse,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t x,
+    __in size_t y,
+    __in size_t width,
+    __in size_t height
+    );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_SPARSE_H_ */
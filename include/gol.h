@@ -22,17 +22,224 @@
 #ifndef GOL_H_
 #define GOL_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
+typedef enum {
+    GOL_ENGINE_DENSE = 0,
+    GOL_ENGINE_HASHLIFE,
+    GOL_ENGINE_SPARSE,
+    GOL_ENGINE_MAX,
+} gol_engine_e;
+
+typedef enum {
+    GOL_BOUNDARY_TORUS = 0,
+    GOL_BOUNDARY_DEAD,
+    GOL_BOUNDARY_MIRROR,
+    GOL_BOUNDARY_MAX,
+} gol_boundary_e;
+
+typedef struct {
+    unsigned long width;
+    unsigned long height;
+    unsigned long threads;
+    gol_engine_e engine;
+    const char *rule;
+    gol_boundary_e boundary;
+    unsigned long depth;
+    unsigned long jump;
+    unsigned long cache;
+    const char *pattern;
+    long x;
+    long y;
+    const char *restore;
+    const char *snapshot;
+    unsigned long interval;
+    int headless;
+    unsigned long generations;
+    double duration;
+    double rate;
+    int stats;
+    const char *log;
+    int binary;
+    unsigned long period;
+    uint64_t seed;
+    double density;
+    unsigned long history;
+    const char *stream;
+    unsigned long cadence;
+    unsigned long keyframe;
+} gol_config_t;
+
+typedef struct {
+    uint64_t generation;
+    uint64_t generations;
+    double time;
+    uint64_t population;
+    uint64_t births;
+    uint64_t deaths;
+    uint64_t tiles;
+    uint64_t period;
+} gol_stats_t;
+
+typedef struct gol_ensemble_s gol_ensemble_t;
+
+typedef struct gol_handle_s gol_handle_t;
+
 int gol(
-    unsigned long width,
-    unsigned long height
+    const gol_config_t *config
+    );
+
+int gol_ensemble_create(
+    gol_ensemble_t **ensemble,
+    const gol_config_t *config,
+    unsigned long count
+    );
+
+void gol_ensemble_destroy(
+    gol_ensemble_t *ensemble
+    );
+
+const char *gol_ensemble_error(
+    const gol_ensemble_t *ensemble
+    );
+
+uint64_t gol_ensemble_generation(
+    const gol_ensemble_t *ensemble
+    );
+
+int gol_ensemble_get(
+    gol_ensemble_t *ensemble,
+    unsigned long index,
+    uint64_t *word,
+    size_t stride
+    );
+
+int gol_ensemble_result(
+    gol_ensemble_t *ensemble,
+    unsigned long index,
+    uint64_t *population,
+    uint64_t *period,
+    uint64_t *generation
+    );
+
+int gol_ensemble_set(
+    gol_ensemble_t *ensemble,
+    unsigned long index,
+    const uint64_t *word,
+    size_t stride
+    );
+
+uint64_t gol_ensemble_settled(
+    const gol_ensemble_t *ensemble
+    );
+
+int gol_ensemble_step(
+    gol_ensemble_t *ensemble,
+    uint64_t generations
     );
 
 const char *gol_error(void);
 
+int gol_handle_cycle(
+    gol_handle_t *handle,
+    uint64_t *period,
+    uint64_t *generation
+    );
+
+int gol_handle_create(
+    gol_handle_t **handle,
+    const gol_config_t *config
+    );
+
+int gol_handle_diff(
+    gol_handle_t *handle,
+    uint64_t from,
+    uint64_t to,
+    unsigned long x,
+    unsigned long y,
+    unsigned long width,
+    unsigned long height,
+    uint64_t *word,
+    size_t stride
+    );
+
+void gol_handle_destroy(
+    gol_handle_t *handle
+    );
+
+const char *gol_handle_error(
+    const gol_handle_t *handle
+    );
+
+uint64_t gol_handle_generation(
+    const gol_handle_t *handle
+    );
+
+int gol_handle_get(
+    gol_handle_t *handle,
+    unsigned long x,
+    unsigned long y,
+    unsigned long width,
+    unsigned long height,
+    uint64_t *word,
+    size_t stride
+    );
+
+const char *gol_handle_memory(
+    const gol_handle_t *handle
+    );
+
+uint64_t gol_handle_population(
+    const gol_handle_t *handle
+    );
+
+int gol_handle_recall(
+    gol_handle_t *handle,
+    uint64_t generation,
+    unsigned long x,
+    unsigned long y,
+    unsigned long width,
+    unsigned long height,
+    uint64_t *word,
+    size_t stride
+    );
+
+int gol_handle_rewind(
+    gol_handle_t *handle,
+    uint64_t generation
+    );
+
+int gol_handle_set(
+    gol_handle_t *handle,
+    unsigned long x,
+    unsigned long y,
+    unsigned long width,
+    unsigned long height,
+    const uint64_t *word,
+    size_t stride
+    );
+
+int gol_handle_stats(
+    gol_handle_t *handle,
+    gol_stats_t *stats
+    );
+
+int gol_handle_step(
+    gol_handle_t *handle,
+    uint64_t generations
+    );
+
+int gol_handle_window(
+    gol_handle_t *handle,
+    uint64_t *oldest,
+    uint64_t *newest
+    );
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
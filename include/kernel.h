@@ -0,0 +1,118 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GOL_KERNEL_H_
+#define GOL_KERNEL_H_
+
+#include "./common.h"
+#include "./rule.h"
+
+#define GOL_KERNEL_DECLARE(_KERNEL_, _RULE_, _BIRTH_, _SURVIVAL_) \
+    void _KERNEL_ ## _ ## _RULE_( \
+        __in const uint64_t *north, \
+        __in const uint64_t *row, \
+        __in const uint64_t *south, \
+        __inout uint64_t *next, \
+        __in size_t count, \
+        __in const gol_rule_t *rule \
+        );
+
+#define GOL_KERNEL_ENSEMBLE_DECLARE(_KERNEL_) \
+    void _KERNEL_ ## _ensemble( \
+        __in const uint64_t *north, \
+        __in const uint64_t *row, \
+        __in const uint64_t *south, \
+        __inout uint64_t *next, \
+        __in size_t count, \
+        __in size_t lanes, \
+        __in const gol_rule_t *rule \
+        );
+
+#define GOL_KERNEL_RULES(_ENTRY_, _KERNEL_) \
+    _ENTRY_(_KERNEL_, life, 0x008, 0x00C) \
+    _ENTRY_(_KERNEL_, highlife, 0x048, 0x00C) \
+    _ENTRY_(_KERNEL_, day_night, 0x1C8, 0x1D8) \
+    _ENTRY_(_KERNEL_, seeds, 0x004, 0x000)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef enum {
+    GOL_KERNEL_SCALAR = 0,
+    GOL_KERNEL_SSE2,
+    GOL_KERNEL_AVX2,
+    GOL_KERNEL_AVX512,
+    GOL_KERNEL_MAX,
+} gol_kernel_e;
+
+typedef void (*gol_kernel_t)(
+    __in const uint64_t *north,
+    __in const uint64_t *row,
+    __in const uint64_t *south,
+    __inout uint64_t *next,
+    __in size_t count,
+    __in const gol_rule_t *rule
+    );
+
+typedef void (*gol_kernel_ensemble_t)(
+    __in const uint64_t *north,
+    __in const uint64_t *row,
+    __in const uint64_t *south,
+    __inout uint64_t *next,
+    __in size_t count,
+    __in size_t lanes,
+    __in const gol_rule_t *rule
+    );
+
+gol_kernel_t gol_kernel(
+    __in gol_kernel_e type,
+    __in const gol_rule_t *rule
+    );
+
+gol_kernel_e gol_kernel_best(void);
+
+gol_kernel_ensemble_t gol_kernel_ensemble(
+    __in gol_kernel_e type
+    );
+
+const char *gol_kernel_name(
+    __in gol_kernel_e type
+    );
+
+GOL_KERNEL_DECLARE(gol_kernel_scalar, generic, 0, 0)
+GOL_KERNEL_RULES(GOL_KERNEL_DECLARE, gol_kernel_scalar)
+GOL_KERNEL_ENSEMBLE_DECLARE(gol_kernel_scalar)
+GOL_KERNEL_DECLARE(gol_kernel_sse2, generic, 0, 0)
+GOL_KERNEL_RULES(GOL_KERNEL_DECLARE, gol_kernel_sse2)
+GOL_KERNEL_ENSEMBLE_DECLARE(gol_kernel_sse2)
+GOL_KERNEL_DECLARE(gol_kernel_avx2, generic, 0, 0)
+GOL_KERNEL_RULES(GOL_KERNEL_DECLARE, gol_kernel_avx2)
+GOL_KERNEL_ENSEMBLE_DECLARE(gol_kernel_avx2)
+GOL_KERNEL_DECLARE(gol_kernel_avx512, generic, 0, 0)
+GOL_KERNEL_RULES(GOL_KERNEL_DECLARE, gol_kernel_avx512)
+GOL_KERNEL_ENSEMBLE_DECLARE(gol_kernel_avx512)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_KERNEL_H_ */
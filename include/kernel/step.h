@@ -0,0 +1,233 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Step kernel template, included once per instruction set with GOL_KERNEL_NAME and GOL_KERNEL_LANES defined.
+ * Each call steps count words of a row, reading one word beyond either end of the north, row and south rows.
+ * One kernel is defined per prebuilt rule, with its birth and survival sets folded in as constants, plus a generic
+ * kernel reading them from the rule. Both evaluate the rule as a select tree over the neighbour count bits.
+ * The ensemble kernel steps bit-sliced universes, where each cell spans lanes words and its neighbours lie lanes
+ * words to either side, so every bit of a word belongs to a different universe.
+ */
+
+#ifndef GOL_KERNEL_NAME
+#error "GOL_KERNEL_NAME must be defined before including kernel/step.h"
+#endif /* GOL_KERNEL_NAME */
+
+#ifndef GOL_KERNEL_LANES
+#error "GOL_KERNEL_LANES must be defined before including kernel/step.h"
+#endif /* GOL_KERNEL_LANES */
+
+#if GOL_KERNEL_LANES > 1
+typedef uint64_t gol_vector_t __attribute__((vector_size(GOL_KERNEL_LANES * sizeof(uint64_t)), aligned(sizeof(uint64_t)), __may_alias__));
+#else
+typedef uint64_t gol_vector_t;
+#endif /* GOL_KERNEL_LANES > 1 */
+
+#define VECTOR_LOAD(_WORD_) \
+    (*(const gol_vector_t *)(_WORD_))
+
+#define VECTOR_STORE(_WORD_, _VALUE_) \
+    (*(gol_vector_t *)(_WORD_) = (_VALUE_))
+
+#define VECTOR_EAST(_WORD_) \
+    ((VECTOR_LOAD(_WORD_) >> 1) | (VECTOR_LOAD((_WORD_) + 1) << 63))
+
+#define VECTOR_WEST(_WORD_) \
+    ((VECTOR_LOAD(_WORD_) << 1) | (VECTOR_LOAD((_WORD_) - 1) >> 63))
+
+#define VECTOR_SELECT(_MASK_, _FALSE_, _TRUE_) \
+    ((_FALSE_) ^ (((_FALSE_) ^ (_TRUE_)) & (_MASK_)))
+
+#define KERNEL_DEFINE(_KERNEL_, _RULE_, _BIRTH_, _SURVIVAL_) \
+    void \
+    _KERNEL_ ## _ ## _RULE_( \
+        __in const uint64_t *north, \
+        __in const uint64_t *row, \
+        __in const uint64_t *south, \
+        __inout uint64_t *next, \
+        __in size_t count, \
+        __in const gol_rule_t *rule \
+        ) \
+    { \
+        size_t index = 0; \
+        uint64_t birth[9], survival[9]; \
+        \
+        for(uint32_t neighbours = 0; neighbours <= 8; ++neighbours) { \
+            birth[neighbours] = -(uint64_t)(((_BIRTH_) >> neighbours) & 1); \
+            survival[neighbours] = -(uint64_t)(((_SURVIVAL_) >> neighbours) & 1); \
+        } \
+        \
+        for(; (index + GOL_KERNEL_LANES) <= count; index += GOL_KERNEL_LANES) { \
+            VECTOR_STORE(&next[index], gol_kernel_vector(&north[index], &row[index], &south[index], birth, survival)); \
+        } \
+        \
+        if(index < count) { \
+            gol_kernel_scalar_ ## _RULE_(&north[index], &row[index], &south[index], &next[index], count - index, rule); \
+        } \
+    }
+
+#define KERNEL_INSTANCE(_KERNEL_, _RULE_, _BIRTH_, _SURVIVAL_) \
+    KERNEL_DEFINE(_KERNEL_, _RULE_, _BIRTH_, _SURVIVAL_)
+
+#define KERNEL_ENSEMBLE(_KERNEL_) \
+    void \
+    _KERNEL_ ## _ensemble( \
+        __in const uint64_t *north, \
+        __in const uint64_t *row, \
+        __in const uint64_t *south, \
+        __inout uint64_t *next, \
+        __in size_t count, \
+        __in size_t lanes, \
+        __in const gol_rule_t *rule \
+        ) \
+    { \
+        size_t index = 0; \
+        uint64_t birth[9], survival[9]; \
+        \
+        for(uint32_t neighbours = 0; neighbours <= 8; ++neighbours) { \
+            birth[neighbours] = -(uint64_t)((rule->birth >> neighbours) & 1); \
+            survival[neighbours] = -(uint64_t)((rule->survival >> neighbours) & 1); \
+        } \
+        \
+        for(; (index + GOL_KERNEL_LANES) <= count; index += GOL_KERNEL_LANES) { \
+            VECTOR_STORE(&next[index], gol_kernel_vector_ensemble(&north[index], &row[index], &south[index], lanes, \
+                birth, survival)); \
+        } \
+        \
+        if(index < count) { \
+            gol_kernel_scalar_ensemble(&north[index], &row[index], &south[index], &next[index], count - index, lanes, \
+                rule); \
+        } \
+    }
+
+#define KERNEL_ENSEMBLE_INSTANCE(_KERNEL_) \
+    KERNEL_ENSEMBLE(_KERNEL_)
+
+static inline gol_vector_t
+gol_kernel_apply(
+    __in const gol_vector_t north_sum[2],
+    __in const gol_vector_t middle_sum[2],
+    __in const gol_vector_t south_sum[2],
+    __in gol_vector_t center,
+    __in const uint64_t birth[9],
+    __in const uint64_t survival[9]
+    )
+{
+    gol_vector_t carry, sum[4], leaf[9], select[4], twos[2];
+
+    sum[0] = north_sum[0] ^ middle_sum[0] ^ south_sum[0];
+    carry = (north_sum[0] & middle_sum[0]) | (south_sum[0] & (north_sum[0] ^ middle_sum[0]));
+    twos[0] = north_sum[1] ^ middle_sum[1] ^ south_sum[1];
+    twos[1] = (north_sum[1] & middle_sum[1]) | (south_sum[1] & (north_sum[1] ^ middle_sum[1]));
+    sum[1] = twos[0] ^ carry;
+    sum[2] = twos[1] ^ (twos[0] & carry);
+    sum[3] = twos[1] & twos[0] & carry;
+
+    for(uint32_t neighbours = 0; neighbours <= 8; ++neighbours) {
+        leaf[neighbours] = (center & survival[neighbours]) | (~center & birth[neighbours]);
+    }
+
+    for(uint32_t neighbours = 0; neighbours < 4; ++neighbours) {
+        select[neighbours] = VECTOR_SELECT(sum[0], leaf[neighbours * 2], leaf[(neighbours * 2) + 1]);
+    }
+
+    select[0] = VECTOR_SELECT(sum[1], select[0], select[1]);
+    select[1] = VECTOR_SELECT(sum[1], select[2], select[3]);
+    select[0] = VECTOR_SELECT(sum[2], select[0], select[1]);
+
+    return VECTOR_SELECT(sum[3], select[0], leaf[8]);
+}
+
+static inline gol_vector_t
+gol_kernel_vector(
+    __in const uint64_t *north,
+    __in const uint64_t *row,
+    __in const uint64_t *south,
+    __in const uint64_t birth[9],
+    __in const uint64_t survival[9]
+    )
+{
+    gol_vector_t center, east, west;
+    gol_vector_t north_sum[2], middle_sum[2], south_sum[2];
+
+    west = VECTOR_WEST(north);
+    center = VECTOR_LOAD(north);
+    east = VECTOR_EAST(north);
+    north_sum[0] = west ^ center ^ east;
+    north_sum[1] = (west & center) | (east & (west ^ center));
+    west = VECTOR_WEST(south);
+    center = VECTOR_LOAD(south);
+    east = VECTOR_EAST(south);
+    south_sum[0] = west ^ center ^ east;
+    south_sum[1] = (west & center) | (east & (west ^ center));
+    west = VECTOR_WEST(row);
+    east = VECTOR_EAST(row);
+    middle_sum[0] = west ^ east;
+    middle_sum[1] = west & east;
+
+    return gol_kernel_apply(north_sum, middle_sum, south_sum, VECTOR_LOAD(row), birth, survival);
+}
+
+static inline gol_vector_t
+gol_kernel_vector_ensemble(
+    __in const uint64_t *north,
+    __in const uint64_t *row,
+    __in const uint64_t *south,
+    __in size_t lanes,
+    __in const uint64_t birth[9],
+    __in const uint64_t survival[9]
+    )
+{
+    gol_vector_t center, east, west;
+    gol_vector_t north_sum[2], middle_sum[2], south_sum[2];
+
+    west = VECTOR_LOAD(north - lanes);
+    center = VECTOR_LOAD(north);
+    east = VECTOR_LOAD(north + lanes);
+    north_sum[0] = west ^ center ^ east;
+    north_sum[1] = (west & center) | (east & (west ^ center));
+    west = VECTOR_LOAD(south - lanes);
+    center = VECTOR_LOAD(south);
+    east = VECTOR_LOAD(south + lanes);
+    south_sum[0] = west ^ center ^ east;
+    south_sum[1] = (west & center) | (east & (west ^ center));
+    west = VECTOR_LOAD(row - lanes);
+    east = VECTOR_LOAD(row + lanes);
+    middle_sum[0] = west ^ east;
+    middle_sum[1] = west & east;
+
+    return gol_kernel_apply(north_sum, middle_sum, south_sum, VECTOR_LOAD(row), birth, survival);
+}
+
+KERNEL_INSTANCE(GOL_KERNEL_NAME, generic, rule->birth, rule->survival)
+GOL_KERNEL_RULES(KERNEL_DEFINE, GOL_KERNEL_NAME)
+KERNEL_ENSEMBLE_INSTANCE(GOL_KERNEL_NAME)
+
+#undef KERNEL_ENSEMBLE_INSTANCE
+#undef KERNEL_ENSEMBLE
+#undef KERNEL_INSTANCE
+#undef KERNEL_DEFINE
+#undef VECTOR_SELECT
+#undef VECTOR_WEST
+#undef VECTOR_EAST
+#undef VECTOR_STORE
+#undef VECTOR_LOAD
@@ -0,0 +1,68 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GOL_LOG_H_
+#define GOL_LOG_H_
+
+#include "./common.h"
+#include "./gol.h"
+
+#define LOG_BATCH 64
+#define LOG_RECORDS 4096
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    FILE *file;
+    bool binary;
+    int result;
+    gol_error_t error;
+    bool exit;
+    size_t head;
+    size_t tail;
+    gol_stats_t *record;
+    pthread_t *thread;
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+} gol_log_t;
+
+int gol_log_init(
+    __inout gol_log_t *log,
+    __in const char *path,
+    __in bool binary
+    );
+
+int gol_log_post(
+    __inout gol_log_t *log,
+    __in const gol_stats_t *record
+    );
+
+int gol_log_uninit(
+    __inout gol_log_t *log
+    );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_LOG_H_ */
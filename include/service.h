@@ -30,6 +30,14 @@ extern "C" {
 
 int gol_service_clear(void);
 
+int gol_service_frame(
+    __in const uint64_t *word,
+    __in const gol_buffer_span_t *span,
+    __in size_t stride,
+    __in uint32_t width,
+    __in uint32_t height
+    );
+
 int gol_service_init(
     __in uint32_t width,
     __in uint32_t height
@@ -0,0 +1,136 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GOL_SNAPSHOT_H_
+#define GOL_SNAPSHOT_H_
+
+#include "./common.h"
+#include "./rule.h"
+
+#define SNAPSHOT_BAND 32
+#define SNAPSHOT_MAGIC 0x534C4F47
+#define SNAPSHOT_OFFSET 4096
+#define SNAPSHOT_VERSION 3
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t width;
+    uint64_t height;
+    uint64_t stride;
+    uint64_t generation;
+    uint64_t checksum;
+    uint64_t table;
+    char rule[RULE_LENGTH];
+} gol_snapshot_header_t;
+
+typedef struct {
+    size_t width;
+    size_t height;
+    size_t stride;
+    char rule[RULE_LENGTH];
+    uint64_t generation;
+    uint64_t *word;
+    size_t planes;
+    size_t bands;
+    const uint64_t *table;
+    uint8_t *verified;
+    void *mapping;
+    size_t size;
+} gol_snapshot_t;
+
+typedef struct {
+    const char *path;
+    int result;
+    gol_error_t error;
+    bool busy;
+    bool exit;
+    size_t width;
+    size_t height;
+    size_t stride;
+    gol_rule_t rule;
+    uint64_t generation;
+    const uint64_t *frame;
+    size_t capacity;
+    uint64_t *word;
+    pthread_t *thread;
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+} gol_snapshot_writer_t;
+
+void gol_snapshot_close(
+    __inout gol_snapshot_t *snapshot
+    );
+
+int gol_snapshot_open(
+    __inout gol_snapshot_t *snapshot,
+    __in const char *path
+    );
+
+int gol_snapshot_save(
+    __in const char *path,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t width,
+    __in size_t height,
+    __in const gol_rule_t *rule,
+    __in uint64_t generation
+    );
+
+int gol_snapshot_verify(
+    __inout gol_snapshot_t *snapshot,
+    __in size_t y,
+    __in size_t height
+    );
+
+bool gol_snapshot_writer_busy(
+    __inout gol_snapshot_writer_t *writer
+    );
+
+int gol_snapshot_writer_init(
+    __inout gol_snapshot_writer_t *writer,
+    __in const char *path
+    );
+
+int gol_snapshot_writer_post(
+    __inout gol_snapshot_writer_t *writer,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t width,
+    __in size_t height,
+    __in const gol_rule_t *rule,
+    __in uint64_t generation,
+    __in bool copy
+    );
+
+int gol_snapshot_writer_uninit(
+    __inout gol_snapshot_writer_t *writer
+    );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_SNAPSHOT_H_ */
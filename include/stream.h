@@ -0,0 +1,112 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GOL_STREAM_H_
+#define GOL_STREAM_H_
+
+#include "./common.h"
+
+#define STREAM_CLIENTS 16
+#define STREAM_KEYFRAME 64
+#define STREAM_MAGIC 0x4D525453
+#define STREAM_VERSION 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef enum {
+    GOL_STREAM_KEYFRAME = 0,
+    GOL_STREAM_DELTA,
+    GOL_STREAM_MAX,
+} gol_stream_e;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t type;
+    uint32_t words;
+    uint64_t width;
+    uint64_t height;
+    uint64_t generation;
+    uint64_t length;
+} gol_stream_header_t;
+
+typedef struct {
+    int socket;
+    bool stale;
+    size_t sent;
+    size_t length;
+    size_t capacity;
+    uint8_t *pending;
+} gol_stream_client_t;
+
+typedef struct {
+    const char *path;
+    bool named;
+    int listener;
+    int wake[2];
+    int result;
+    gol_error_t error;
+    bool exit;
+    size_t width;
+    size_t height;
+    size_t stride;
+    size_t words;
+    uint64_t mask;
+    uint64_t cadence;
+    uint64_t keyframe;
+    uint64_t due;
+    uint64_t frames;
+    gol_buffer_t buffer;
+    uint64_t *previous;
+    uint8_t *message[GOL_STREAM_MAX];
+    size_t length[GOL_STREAM_MAX];
+    size_t capacity[GOL_STREAM_MAX];
+    gol_stream_client_t client[STREAM_CLIENTS];
+    pthread_t *thread;
+} gol_stream_t;
+
+int gol_stream_init(
+    __inout gol_stream_t *stream,
+    __in const char *path,
+    __in size_t stride,
+    __in size_t width,
+    __in size_t height,
+    __in uint64_t cadence,
+    __in uint64_t keyframe
+    );
+
+int gol_stream_post(
+    __inout gol_stream_t *stream,
+    __in const uint64_t *frame,
+    __in uint64_t generation
+    );
+
+int gol_stream_uninit(
+    __inout gol_stream_t *stream
+    );
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GOL_STREAM_H_ */
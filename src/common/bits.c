@@ -0,0 +1,211 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "../../include/common/bits.h"
+
+#define BITS_MASK(_COUNT_, _SHIFT_) \
+    ((((_COUNT_) < WORD_BITS) ? ((UINT64_C(1) << (_COUNT_)) - 1) : UINT64_MAX) << (_SHIFT_))
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static inline uint64_t
+gol_bits_mix(
+    __in uint64_t position,
+    __in uint64_t value
+    )
+{
+    uint64_t result = value ^ (position * UINT64_C(0x9E3779B97F4A7C15));
+
+    result = (result ^ (result >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    result = (result ^ (result >> 27)) * UINT64_C(0x94D049BB133111EB);
+
+    return (result ^ (result >> 31)) & -(uint64_t)(value != 0);
+}
+
+static inline __attribute__((always_inline)) void
+gol_bits_churn_count(
+    __in const uint64_t *previous,
+    __in const uint64_t *next,
+    __in size_t count,
+    __in uint64_t mask,
+    __inout uint64_t *births,
+    __inout uint64_t *deaths
+    )
+{
+    uint64_t born = 0, died = 0;
+
+    for(size_t index = 0; index < count; ++index) {
+        uint64_t change = (next[index] ^ previous[index]) & (((index + 1) == count) ? mask : UINT64_MAX);
+
+        born += __builtin_popcountll(change & next[index]);
+        died += __builtin_popcountll(change & previous[index]);
+    }
+
+    *births += born;
+    *deaths += died;
+}
+
+static void
+gol_bits_churn_generic(
+    __in const uint64_t *previous,
+    __in const uint64_t *next,
+    __in size_t count,
+    __in uint64_t mask,
+    __inout uint64_t *births,
+    __inout uint64_t *deaths
+    )
+{
+    gol_bits_churn_count(previous, next, count, mask, births, deaths);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+static __attribute__((target("popcnt"))) void
+gol_bits_churn_popcnt(
+    __in const uint64_t *previous,
+    __in const uint64_t *next,
+    __in size_t count,
+    __in uint64_t mask,
+    __inout uint64_t *births,
+    __inout uint64_t *deaths
+    )
+{
+    gol_bits_churn_count(previous, next, count, mask, births, deaths);
+}
+#endif /* __x86_64__ || __i386__ */
+
+gol_bits_churn_t
+gol_bits_churn(void)
+{
+    gol_bits_churn_t result = gol_bits_churn_generic;
+
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+
+    if(__builtin_cpu_supports("popcnt")) {
+        result = gol_bits_churn_popcnt;
+    }
+#endif /* __x86_64__ || __i386__ */
+
+    return result;
+}
+
+void
+gol_bits_copy(
+    __inout uint64_t *word,
+    __in size_t offset,
+    __in const uint64_t *source,
+    __in size_t source_offset,
+    __in size_t count
+    )
+{
+
+    while(count) {
+        uint64_t mask, value;
+        size_t shift = offset & (WORD_BITS - 1), source_shift = source_offset & (WORD_BITS - 1),
+            bits = WORD_BITS - shift;
+
+        if(bits > count) {
+            bits = count;
+        }
+
+        mask = BITS_MASK(bits, shift);
+        value = source[source_offset / WORD_BITS] >> source_shift;
+
+        if(source_shift && ((source_shift + bits) > WORD_BITS)) {
+            value |= source[(source_offset / WORD_BITS) + 1] << (WORD_BITS - source_shift);
+        }
+
+        word[offset / WORD_BITS] = (word[offset / WORD_BITS] & ~mask) | ((value << shift) & mask);
+        offset += bits;
+        source_offset += bits;
+        count -= bits;
+    }
+}
+
+void
+gol_bits_fill(
+    __inout uint64_t *word,
+    __in size_t offset,
+    __in size_t count,
+    __in bool value
+    )
+{
+
+    while(count) {
+        uint64_t mask;
+        size_t shift = offset & (WORD_BITS - 1), bits = WORD_BITS - shift;
+
+        if(bits > count) {
+            bits = count;
+        }
+
+        mask = BITS_MASK(bits, shift);
+        word[offset / WORD_BITS] = value ? (word[offset / WORD_BITS] | mask) : (word[offset / WORD_BITS] & ~mask);
+        offset += bits;
+        count -= bits;
+    }
+}
+
+uint64_t
+gol_bits_hash(
+    __in const uint64_t *word,
+    __in size_t count,
+    __in uint64_t mask,
+    __in uint64_t position
+    )
+{
+    uint64_t result = 0;
+
+    for(size_t index = 0; index < count; ++index) {
+        result ^= gol_bits_mix(position + index, word[index] & (((index + 1) == count) ? mask : UINT64_MAX));
+    }
+
+    return result;
+}
+
+uint64_t
+gol_bits_rehash(
+    __in const uint64_t *previous,
+    __in const uint64_t *next,
+    __in size_t count,
+    __in uint64_t mask,
+    __in uint64_t position
+    )
+{
+    uint64_t result = 0;
+
+    for(size_t index = 0; (index + 1) < count; ++index) {
+        result ^= gol_bits_mix(position + index, previous[index]) ^ gol_bits_mix(position + index, next[index]);
+    }
+
+    if(count) {
+        result ^= gol_bits_mix(position + count - 1, previous[count - 1] & mask)
+            ^ gol_bits_mix(position + count - 1, next[count - 1] & mask);
+    }
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
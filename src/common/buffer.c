@@ -0,0 +1,183 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "../../include/common/buffer.h"
+#include "../../include/common/error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+gol_buffer_slot_t *
+gol_buffer_acquire(
+    __inout gol_buffer_t *buffer
+    )
+{
+    gol_buffer_slot_t *result = NULL;
+
+    if(!(__atomic_load_n(&buffer->middle, __ATOMIC_ACQUIRE) & BUFFER_FRESH)) {
+        result = &buffer->slot[buffer->back];
+    }
+
+    return result;
+}
+
+const gol_buffer_slot_t *
+gol_buffer_consume(
+    __inout gol_buffer_t *buffer
+    )
+{
+    const gol_buffer_slot_t *result = NULL;
+
+    if(__atomic_load_n(&buffer->middle, __ATOMIC_ACQUIRE) & BUFFER_FRESH) {
+        buffer->front = __atomic_exchange_n(&buffer->middle, buffer->front, __ATOMIC_ACQ_REL) & ~BUFFER_FRESH;
+        result = &buffer->slot[buffer->front];
+    }
+
+    return result;
+}
+
+int
+gol_buffer_init(
+    __inout gol_buffer_t *buffer,
+    __in size_t stride,
+    __in size_t height
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    memset(buffer, 0, sizeof(*buffer));
+    buffer->size = stride * height;
+    buffer->stride = stride;
+    buffer->height = height;
+    buffer->bands = (height + BUFFER_BAND - 1) / BUFFER_BAND;
+    buffer->previous = BUFFER_SLOTS;
+    buffer->back = 0;
+    buffer->middle = 1;
+    buffer->front = 2;
+
+    for(uint32_t index = 0; index < BUFFER_SLOTS; ++index) {
+
+        if(!(buffer->slot[index].word = calloc(buffer->size, sizeof(uint64_t)))) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+
+        if(!(buffer->slot[index].span = calloc(buffer->bands, sizeof(gol_buffer_span_t)))) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+    }
+
+exit:
+    return result;
+}
+
+void
+gol_buffer_publish(
+    __inout gol_buffer_t *buffer,
+    __in uint64_t generation
+    )
+{
+    buffer->slot[buffer->back].generation = generation;
+    buffer->previous = buffer->back;
+    buffer->back = __atomic_exchange_n(&buffer->middle, buffer->back | BUFFER_FRESH, __ATOMIC_ACQ_REL) & ~BUFFER_FRESH;
+}
+
+void
+gol_buffer_uninit(
+    __inout gol_buffer_t *buffer
+    )
+{
+
+    for(uint32_t index = 0; index < BUFFER_SLOTS; ++index) {
+
+        if(buffer->slot[index].word) {
+            free(buffer->slot[index].word);
+        }
+
+        if(buffer->slot[index].span) {
+            free(buffer->slot[index].span);
+        }
+    }
+
+    memset(buffer, 0, sizeof(*buffer));
+}
+
+void
+gol_buffer_write(
+    __inout gol_buffer_t *buffer,
+    __inout gol_buffer_slot_t *slot,
+    __in const uint64_t *frame
+    )
+{
+    const uint64_t *previous = NULL;
+
+    if(buffer->previous < BUFFER_SLOTS) {
+        previous = buffer->slot[buffer->previous].word;
+    }
+
+    for(size_t band = 0; band < buffer->bands; ++band) {
+        gol_buffer_span_t *span = &slot->span[band];
+        size_t first = band * BUFFER_BAND, last = first + BUFFER_BAND;
+
+        if(last > buffer->height) {
+            last = buffer->height;
+        }
+
+        span->begin = previous ? buffer->stride : 0;
+        span->end = previous ? 0 : buffer->stride;
+
+        for(size_t y = first; y < last; ++y) {
+            const uint64_t *row = &frame[y * buffer->stride];
+
+            if(previous) {
+                const uint64_t *shown = &previous[y * buffer->stride];
+                size_t begin = 0, end = buffer->stride;
+
+                while((begin < end) && (row[begin] == shown[begin])) {
+                    ++begin;
+                }
+
+                if(begin < end) {
+
+                    while(row[end - 1] == shown[end - 1]) {
+                        --end;
+                    }
+
+                    if(begin < span->begin) {
+                        span->begin = begin;
+                    }
+
+                    if(end > span->end) {
+                        span->end = end;
+                    }
+                }
+            }
+
+            memcpy(&slot->word[y * buffer->stride], row, buffer->stride * sizeof(uint64_t));
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
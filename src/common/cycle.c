@@ -0,0 +1,114 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "../../include/common/cycle.h"
+#include "../../include/common/error.h"
+
+#define CYCLE_ENTRY(_CYCLE_, _BACK_) \
+    (((_CYCLE_)->count - 1 - (_BACK_)) % (2 * (_CYCLE_)->limit))
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int
+gol_cycle_init(
+    __inout gol_cycle_t *cycle,
+    __in size_t limit
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    memset(cycle, 0, sizeof(*cycle));
+    cycle->limit = limit;
+
+    if(!(cycle->hash = calloc(2 * limit, sizeof(uint64_t)))
+            || !(cycle->generation = calloc(2 * limit, sizeof(uint64_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+exit:
+    return result;
+}
+
+bool
+gol_cycle_push(
+    __inout gol_cycle_t *cycle,
+    __in uint64_t hash,
+    __in uint64_t generation
+    )
+{
+
+    if(!cycle->period) {
+        cycle->hash[cycle->count % (2 * cycle->limit)] = hash;
+        cycle->generation[cycle->count % (2 * cycle->limit)] = generation;
+        ++cycle->count;
+
+        for(size_t period = 1; (period <= cycle->limit) && ((2 * period) <= cycle->count); ++period) {
+            size_t back = 0;
+
+            while((back < period)
+                    && (cycle->hash[CYCLE_ENTRY(cycle, back)] == cycle->hash[CYCLE_ENTRY(cycle, back + period)])) {
+                ++back;
+            }
+
+            if(back == period) {
+                cycle->period = generation - cycle->generation[CYCLE_ENTRY(cycle, period)];
+                cycle->since = cycle->generation[CYCLE_ENTRY(cycle, (2 * period) - 1)];
+                break;
+            }
+        }
+    }
+
+    return cycle->period != 0;
+}
+
+void
+gol_cycle_reset(
+    __inout gol_cycle_t *cycle
+    )
+{
+    cycle->count = 0;
+    cycle->period = 0;
+    cycle->since = 0;
+}
+
+void
+gol_cycle_uninit(
+    __inout gol_cycle_t *cycle
+    )
+{
+
+    if(cycle->hash) {
+        free(cycle->hash);
+    }
+
+    if(cycle->generation) {
+        free(cycle->generation);
+    }
+
+    memset(cycle, 0, sizeof(*cycle));
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -21,12 +21,7 @@
 
 #include "../../include/common/error.h"
 
-typedef struct {
-    int error;
-    char str[64];
-} gol_error_t;
-
-static gol_error_t g_error = {};
+static __thread gol_error_t g_error = {};
 
 #ifdef __cplusplus
 extern "C" {
@@ -38,6 +33,22 @@ gol_error(void)
     return g_error.str;
 }
 
+void
+gol_error_restore(
+    __in const gol_error_t *error
+    )
+{
+    g_error = *error;
+}
+
+void
+gol_error_save(
+    __out gol_error_t *error
+    )
+{
+    *error = g_error;
+}
+
 int
 gol_error_set(
     __in int error,
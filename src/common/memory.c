@@ -0,0 +1,157 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <sys/mman.h>
+#include "../../include/common/error.h"
+#include "../../include/common/memory.h"
+
+#define MEMORY_TRANSPARENT "/sys/kernel/mm/transparent_hugepage/enabled"
+
+static const char *MEMORY_NAME[] = {
+    "heap",
+    "pages",
+    "transparent",
+    "hugetlb",
+    };
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static bool
+gol_memory_transparent(void)
+{
+    FILE *file;
+    char mode[64] = {};
+
+    if((file = fopen(MEMORY_TRANSPARENT, "r"))) {
+
+        if(!fgets(mode, sizeof(mode), file)) {
+            mode[0] = '\0';
+        }
+
+        fclose(file);
+    }
+
+    return mode[0] && !strstr(mode, "[never]");
+}
+
+int
+gol_memory_allocate(
+    __out gol_memory_t *memory,
+    __in size_t size,
+    __in size_t colour
+    )
+{
+    uint8_t *base;
+    size_t head, tail;
+    int result = EXIT_SUCCESS;
+
+    memset(memory, 0, sizeof(*memory));
+    colour &= ~(size_t)(MEMORY_LINE - 1);
+    memory->size = (size + colour + MEMORY_LINE - 1) & ~(size_t)(MEMORY_LINE - 1);
+
+    if(memory->size < MEMORY_HUGE) {
+
+        if(posix_memalign(&memory->base, MEMORY_LINE, memory->size)) {
+            memory->base = NULL;
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+
+        memset(memory->base, 0, memory->size);
+        memory->mode = GOL_MEMORY_HEAP;
+        goto exit;
+    }
+
+    memory->size = (memory->size + MEMORY_HUGE - 1) & ~(size_t)(MEMORY_HUGE - 1);
+
+#ifdef MAP_HUGETLB
+    if((memory->base = mmap(NULL, memory->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1,
+            0)) != MAP_FAILED) {
+        memory->mode = GOL_MEMORY_HUGETLB;
+        goto exit;
+    }
+#endif /* MAP_HUGETLB */
+
+    if((base = mmap(NULL, memory->size + MEMORY_HUGE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0))
+            == MAP_FAILED) {
+        memory->base = NULL;
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    head = (MEMORY_HUGE - ((uintptr_t)base & (MEMORY_HUGE - 1))) & (MEMORY_HUGE - 1);
+    tail = MEMORY_HUGE - head;
+
+    if(head) {
+        munmap(base, head);
+    }
+
+    munmap(base + head + memory->size, tail);
+
+    memory->base = base + head;
+    memory->mode = GOL_MEMORY_PAGES;
+
+#ifdef MADV_HUGEPAGE
+    if(!madvise(memory->base, memory->size, MADV_HUGEPAGE) && gol_memory_transparent()) {
+        memory->mode = GOL_MEMORY_TRANSPARENT;
+    }
+#endif /* MADV_HUGEPAGE */
+
+exit:
+
+    if(result == EXIT_SUCCESS) {
+        memory->data = (uint8_t *)memory->base + colour;
+    }
+
+    return result;
+}
+
+void
+gol_memory_free(
+    __inout gol_memory_t *memory
+    )
+{
+
+    if(memory->base) {
+
+        if(memory->mode == GOL_MEMORY_HEAP) {
+            free(memory->base);
+        } else {
+            munmap(memory->base, memory->size);
+        }
+    }
+
+    memset(memory, 0, sizeof(*memory));
+}
+
+const char *
+gol_memory_name(
+    __in gol_memory_e mode
+    )
+{
+    return (mode < GOL_MEMORY_MAX) ? MEMORY_NAME[mode] : "unknown";
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,218 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "../../include/common/error.h"
+#include "../../include/common/mipmap.h"
+
+#define MIPMAP_BLOCK (1 << MIPMAP_BASE)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static uint64_t
+gol_mipmap_count(
+    __in uint64_t value
+    )
+{
+    value -= (value >> 1) & 0x5555555555555555;
+    value = (value & 0x3333333333333333) + ((value >> 2) & 0x3333333333333333);
+
+    return (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0F;
+}
+
+static uint8_t
+gol_mipmap_child(
+    __in const gol_mipmap_t *mipmap,
+    __in uint32_t level,
+    __in size_t x,
+    __in size_t y
+    )
+{
+    uint8_t result = 0;
+
+    if((x < mipmap->level_width[level]) && (y < mipmap->level_height[level])) {
+        result = mipmap->density[level][(y * mipmap->level_width[level]) + x];
+    }
+
+    return result;
+}
+
+uint8_t
+gol_mipmap_density(
+    __in const gol_mipmap_t *mipmap,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in uint32_t level,
+    __in size_t x,
+    __in size_t y
+    )
+{
+    uint32_t count = 0, size = 1 << level;
+
+    if(level >= MIPMAP_BASE) {
+        return gol_mipmap_child(mipmap, (level <= mipmap->top) ? level : mipmap->top, x, y);
+    }
+
+    x <<= level;
+    y <<= level;
+
+    if(x >= mipmap->width) {
+        return 0;
+    }
+
+    for(size_t row = y; (row < (y + size)) && (row < mipmap->height); ++row) {
+        count += __builtin_popcountll((word[(row * stride) + (x / WORD_BITS)] >> (x & (WORD_BITS - 1))) & ((1 << size) - 1));
+    }
+
+    return ((count * 255) + ((size * size) / 2)) / (size * size);
+}
+
+int
+gol_mipmap_init(
+    __inout gol_mipmap_t *mipmap,
+    __in size_t width,
+    __in size_t height
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    memset(mipmap, 0, sizeof(*mipmap));
+    mipmap->width = width;
+    mipmap->height = height;
+
+    for(uint32_t level = MIPMAP_BASE; level < MIPMAP_LEVELS; ++level) {
+        mipmap->level_width[level] = (width + (1ULL << level) - 1) >> level;
+        mipmap->level_height[level] = (height + (1ULL << level) - 1) >> level;
+
+        if(!(mipmap->density[level] = calloc(mipmap->level_width[level] * mipmap->level_height[level], sizeof(uint8_t)))) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+
+        mipmap->top = level;
+
+        if((mipmap->level_width[level] <= 1) && (mipmap->level_height[level] <= 1)) {
+            break;
+        }
+    }
+
+exit:
+    return result;
+}
+
+void
+gol_mipmap_uninit(
+    __inout gol_mipmap_t *mipmap
+    )
+{
+
+    for(uint32_t level = MIPMAP_BASE; level < MIPMAP_LEVELS; ++level) {
+
+        if(mipmap->density[level]) {
+            free(mipmap->density[level]);
+        }
+    }
+
+    memset(mipmap, 0, sizeof(*mipmap));
+}
+
+void
+gol_mipmap_update(
+    __inout gol_mipmap_t *mipmap,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t x,
+    __in size_t y,
+    __in size_t width,
+    __in size_t height
+    )
+{
+    size_t begin[2], end[2];
+
+    if((x + width) > mipmap->width) {
+        width = (x < mipmap->width) ? (mipmap->width - x) : 0;
+    }
+
+    if((y + height) > mipmap->height) {
+        height = (y < mipmap->height) ? (mipmap->height - y) : 0;
+    }
+
+    if(!width || !height) {
+        return;
+    }
+
+    begin[0] = x / WORD_BITS;
+    end[0] = (x + width + WORD_BITS - 1) / WORD_BITS;
+    begin[1] = y / MIPMAP_BLOCK;
+    end[1] = (y + height + MIPMAP_BLOCK - 1) / MIPMAP_BLOCK;
+
+    for(size_t block = begin[1]; block < end[1]; ++block) {
+        uint8_t *density = &mipmap->density[MIPMAP_BASE][block * mipmap->level_width[MIPMAP_BASE]];
+
+        for(size_t column = begin[0]; column < end[0]; ++column) {
+            uint64_t count = 0;
+
+            for(size_t row = block * MIPMAP_BLOCK; (row < ((block + 1) * MIPMAP_BLOCK)) && (row < mipmap->height); ++row) {
+                count += gol_mipmap_count(word[(row * stride) + column]);
+            }
+
+            for(size_t lane = 0; (lane < (WORD_BITS / MIPMAP_BLOCK))
+                    && (((column * (WORD_BITS / MIPMAP_BLOCK)) + lane) < mipmap->level_width[MIPMAP_BASE]); ++lane) {
+                density[(column * (WORD_BITS / MIPMAP_BLOCK)) + lane] = ((((count >> (lane * 8)) & 0xFF) * 255)
+                    + ((MIPMAP_BLOCK * MIPMAP_BLOCK) / 2)) / (MIPMAP_BLOCK * MIPMAP_BLOCK);
+            }
+        }
+    }
+
+    begin[0] *= WORD_BITS / MIPMAP_BLOCK;
+    end[0] *= WORD_BITS / MIPMAP_BLOCK;
+
+    for(uint32_t level = MIPMAP_BASE + 1; level <= mipmap->top; ++level) {
+        begin[0] >>= 1;
+        begin[1] >>= 1;
+        end[0] = (end[0] + 1) >> 1;
+        end[1] = (end[1] + 1) >> 1;
+
+        if(end[0] > mipmap->level_width[level]) {
+            end[0] = mipmap->level_width[level];
+        }
+
+        if(end[1] > mipmap->level_height[level]) {
+            end[1] = mipmap->level_height[level];
+        }
+
+        for(size_t row = begin[1]; row < end[1]; ++row) {
+
+            for(size_t column = begin[0]; column < end[0]; ++column) {
+                mipmap->density[level][(row * mipmap->level_width[level]) + column] =
+                    (gol_mipmap_child(mipmap, level - 1, column * 2, row * 2)
+                        + gol_mipmap_child(mipmap, level - 1, (column * 2) + 1, row * 2)
+                        + gol_mipmap_child(mipmap, level - 1, column * 2, (row * 2) + 1)
+                        + gol_mipmap_child(mipmap, level - 1, (column * 2) + 1, (row * 2) + 1) + 2) / 4;
+            }
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,208 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <unistd.h>
+#include "../../include/common/error.h"
+#include "../../include/common/pool.h"
+
+typedef struct {
+    gol_pool_t *pool;
+    size_t index;
+} gol_pool_worker_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static void *
+gol_pool_worker(
+    __in void *argument
+    )
+{
+    gol_pool_t *pool = ((gol_pool_worker_t *)argument)->pool;
+    size_t index = ((gol_pool_worker_t *)argument)->index;
+    uint64_t generation = 0;
+
+    free(argument);
+    pthread_mutex_lock(&pool->lock);
+
+    for(;;) {
+
+        while(!pool->exit && (pool->generation == generation)) {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+
+        if(pool->exit) {
+            break;
+        }
+
+        generation = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+        pool->task(pool->context, index, pool->count);
+        pthread_mutex_lock(&pool->lock);
+
+        if(!--pool->pending) {
+            pthread_cond_signal(&pool->done);
+        }
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+void
+gol_pool_counters(
+    __in const gol_pool_t *pool,
+    __out gol_pool_counter_t *total
+    )
+{
+    memset(total, 0, sizeof(*total));
+
+    for(size_t index = 0; index < pool->count; ++index) {
+        total->births += pool->counter[index].births;
+        total->deaths += pool->counter[index].deaths;
+        total->tiles += pool->counter[index].tiles;
+        total->digest ^= pool->counter[index].digest;
+    }
+}
+
+int
+gol_pool_init(
+    __inout gol_pool_t *pool,
+    __in size_t count
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    memset(pool, 0, sizeof(*pool));
+
+    if(!count) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+
+        count = (online > 0) ? online : 1;
+    }
+
+    if(pthread_mutex_init(&pool->lock, NULL)
+            || pthread_cond_init(&pool->start, NULL)
+            || pthread_cond_init(&pool->done, NULL)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!(pool->thread = calloc(count, sizeof(pthread_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!(pool->counter = calloc(count, sizeof(gol_pool_counter_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    pool->count = 1;
+
+    for(; pool->count < count; ++pool->count) {
+        gol_pool_worker_t *worker;
+
+        if(!(worker = calloc(1, sizeof(*worker)))) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+
+        worker->pool = pool;
+        worker->index = pool->count;
+
+        if(pthread_create(&pool->thread[pool->count], NULL, gol_pool_worker, worker)) {
+            free(worker);
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+    }
+
+exit:
+    return result;
+}
+
+void
+gol_pool_run(
+    __inout gol_pool_t *pool,
+    __in gol_pool_task_t task,
+    __in void *context
+    )
+{
+
+    if(pool->count > 1) {
+        pthread_mutex_lock(&pool->lock);
+        pool->task = task;
+        pool->context = context;
+        pool->pending = pool->count - 1;
+        ++pool->generation;
+        pthread_cond_broadcast(&pool->start);
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    task(context, 0, pool->count);
+
+    if(pool->count > 1) {
+        pthread_mutex_lock(&pool->lock);
+
+        while(pool->pending) {
+            pthread_cond_wait(&pool->done, &pool->lock);
+        }
+
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+void
+gol_pool_uninit(
+    __inout gol_pool_t *pool
+    )
+{
+
+    if(pool->thread) {
+        pthread_mutex_lock(&pool->lock);
+        pool->exit = true;
+        pthread_cond_broadcast(&pool->start);
+        pthread_mutex_unlock(&pool->lock);
+
+        for(size_t index = 1; index < pool->count; ++index) {
+            pthread_join(pool->thread[index], NULL);
+        }
+
+        free(pool->thread);
+
+        if(pool->counter) {
+            free(pool->counter);
+        }
+
+        pthread_cond_destroy(&pool->done);
+        pthread_cond_destroy(&pool->start);
+        pthread_mutex_destroy(&pool->lock);
+    }
+
+    memset(pool, 0, sizeof(*pool));
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
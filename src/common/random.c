@@ -0,0 +1,85 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <time.h>
+#include "../../include/common/random.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static inline uint64_t
+gol_random_word(
+    __in uint64_t seed,
+    __in uint64_t counter
+    )
+{
+    uint64_t value = seed + (counter * UINT64_C(0xA0761D6478BD642F));
+    __uint128_t result = (__uint128_t)value * (value ^ UINT64_C(0xE7037ED1A0B428DB));
+
+    return (uint64_t)(result >> 64) ^ (uint64_t)result;
+}
+
+void
+gol_random_fill(
+    __in const gol_random_t *random,
+    __out uint64_t *word,
+    __in size_t count,
+    __in uint64_t position
+    )
+{
+
+    if(random->density == (UINT32_C(1) << RANDOM_BITS)) {
+        memset(word, 0xFF, count * sizeof(uint64_t));
+    } else if(!random->density) {
+        memset(word, 0, count * sizeof(uint64_t));
+    } else {
+
+        for(size_t index = 0; index < count; ++index) {
+            uint64_t counter = (position + index) * RANDOM_BITS, value = 0;
+
+            for(uint32_t draw = RANDOM_BITS - random->draws; draw < RANDOM_BITS; ++draw) {
+                uint64_t bits = gol_random_word(random->seed, counter + draw);
+
+                value = (value & bits) | ((value ^ bits) & -(uint64_t)((random->density >> draw) & 1));
+            }
+
+            word[index] = value;
+        }
+    }
+}
+
+void
+gol_random_init(
+    __out gol_random_t *random,
+    __in uint64_t seed,
+    __in double density
+    )
+{
+    random->seed = seed ? seed : (uint64_t)time(NULL);
+    density = (density > 0) ? density : 0.5;
+    random->density = ((density < 1) ? density : 1) * (UINT32_C(1) << RANDOM_BITS) + 0.5;
+    random->draws = random->density ? (RANDOM_BITS - __builtin_ctz(random->density)) : 0;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
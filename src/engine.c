@@ -0,0 +1,655 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <time.h>
+#include "../include/engine.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static uint64_t
+gol_engine_digest(
+    __in const gol_engine_t *engine
+    )
+{
+    uint64_t result = 0;
+
+    switch(engine->type) {
+        case GOL_ENGINE_DENSE:
+            result = gol_dense_digest(&engine->dense);
+            break;
+        case GOL_ENGINE_SPARSE:
+            result = gol_sparse_digest(&engine->sparse);
+            break;
+        default:
+            break;
+    }
+
+    return result;
+}
+
+static void
+gol_engine_measure(
+    __inout gol_engine_t *engine,
+    __in const struct timespec *begin,
+    __in uint64_t generation
+    )
+{
+    struct timespec end;
+    gol_pool_counter_t total = {};
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    switch(engine->type) {
+        case GOL_ENGINE_DENSE:
+            gol_pool_counters(&engine->dense.pool, &total);
+            break;
+        case GOL_ENGINE_SPARSE:
+            gol_pool_counters(&engine->sparse.pool, &total);
+            break;
+        default:
+            break;
+    }
+
+    engine->record.generation = engine->generation;
+    engine->record.generations = engine->generation - generation;
+    engine->record.time = (end.tv_sec - begin->tv_sec) + ((end.tv_nsec - begin->tv_nsec) / 1e9);
+    engine->record.births = total.births - engine->total.births;
+    engine->record.deaths = total.deaths - engine->total.deaths;
+    engine->record.tiles = total.tiles - engine->total.tiles;
+    engine->record.period = engine->cycle.period;
+
+    if(engine->type == GOL_ENGINE_HASHLIFE) {
+        engine->record.population = gol_hashlife_population(&engine->hashlife);
+    } else {
+        engine->record.population += engine->record.births - engine->record.deaths;
+    }
+
+    engine->total = total;
+}
+
+static void
+gol_engine_fold(
+    __inout gol_engine_t *engine
+    )
+{
+    gol_pool_counter_t total = {};
+
+    gol_pool_counters((engine->type == GOL_ENGINE_DENSE) ? &engine->dense.pool : &engine->sparse.pool, &total);
+    engine->digest ^= total.digest ^ engine->folded;
+    engine->folded = total.digest;
+}
+
+static int
+gol_engine_probe(
+    __inout gol_engine_t *engine
+    )
+{
+    size_t depth = engine->dense.depth;
+    gol_pool_counter_t before = {}, after = {};
+    uint64_t digest = engine->digest, generation = engine->dense.generation;
+    int result = EXIT_SUCCESS;
+
+    gol_pool_counters(&engine->dense.pool, &before);
+    engine->dense.depth = 1;
+
+    for(uint64_t period = 1; period <= engine->cycle.period; ++period) {
+
+        if((result = gol_dense_step(&engine->dense)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+
+        gol_engine_fold(engine);
+
+        if(!(engine->cycle.period % period) && (engine->digest == digest)) {
+            engine->cycle.period = period;
+            break;
+        }
+    }
+
+    gol_dense_renumber(&engine->dense, generation);
+
+exit:
+    gol_pool_counters(&engine->dense.pool, &after);
+    engine->total.births += after.births - before.births;
+    engine->total.deaths += after.deaths - before.deaths;
+    engine->total.tiles += after.tiles - before.tiles;
+    engine->dense.depth = depth;
+
+    return result;
+}
+
+static uint64_t
+gol_engine_skip(
+    __inout gol_engine_t *engine,
+    __in uint64_t generations
+    )
+{
+    uint64_t skip;
+
+    if(engine->cycle.period && (skip = generations - (generations % engine->cycle.period))) {
+
+        if(engine->type == GOL_ENGINE_DENSE) {
+            gol_dense_renumber(&engine->dense, engine->dense.generation + skip);
+        }
+
+        engine->generation += skip;
+        generations -= skip;
+    }
+
+    return generations;
+}
+
+static int
+gol_engine_track(
+    __inout gol_engine_t *engine,
+    __in uint64_t depth
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    if(engine->cycle.limit) {
+        gol_engine_fold(engine);
+
+        if(!engine->cycle.period && !((engine->generation - engine->origin) % depth)
+                && gol_cycle_push(&engine->cycle, engine->digest, engine->generation)
+                && (engine->type == GOL_ENGINE_DENSE) && (engine->cycle.period > 1)) {
+            result = gol_engine_probe(engine);
+        }
+    }
+
+    return result;
+}
+
+int
+gol_engine_advance(
+    __inout gol_engine_t *engine,
+    __in uint64_t generations
+    )
+{
+    size_t depth;
+    uint32_t jump;
+    struct timespec begin = {};
+    uint64_t generation = engine->generation;
+    int result = EXIT_SUCCESS;
+
+    if(engine->stats) {
+        clock_gettime(CLOCK_MONOTONIC, &begin);
+    }
+
+    switch(engine->type) {
+        case GOL_ENGINE_DENSE:
+            depth = engine->dense.depth;
+
+            while((generations = gol_engine_skip(engine, generations))) {
+                engine->dense.depth = depth;
+
+                if(engine->cycle.limit) {
+                    engine->dense.depth -= (engine->generation - engine->origin) % depth;
+                }
+
+                if(generations < engine->dense.depth) {
+                    engine->dense.depth = generations;
+                }
+
+                if((result = gol_dense_step(&engine->dense)) != EXIT_SUCCESS) {
+                    break;
+                }
+
+                engine->generation += engine->dense.depth;
+                generations -= engine->dense.depth;
+
+                if((result = gol_engine_track(engine, depth)) != EXIT_SUCCESS) {
+                    break;
+                }
+            }
+
+            engine->dense.depth = depth;
+            break;
+        case GOL_ENGINE_HASHLIFE:
+            jump = engine->hashlife.jump;
+
+            for(; generations; generations -= UINT64_C(1) << engine->hashlife.jump) {
+                engine->hashlife.jump = (WORD_BITS - 1) - __builtin_clzll(generations);
+
+                if(engine->hashlife.jump > (HASHLIFE_LEVEL_MAX - 3)) {
+                    engine->hashlife.jump = HASHLIFE_LEVEL_MAX - 3;
+                }
+
+                if((result = gol_hashlife_step(&engine->hashlife)) != EXIT_SUCCESS) {
+                    break;
+                }
+
+                engine->generation += UINT64_C(1) << engine->hashlife.jump;
+            }
+
+            engine->hashlife.jump = jump;
+            break;
+        case GOL_ENGINE_SPARSE:
+
+            while((generations = gol_engine_skip(engine, generations))) {
+
+                if((result = gol_sparse_step(&engine->sparse)) != EXIT_SUCCESS) {
+                    break;
+                }
+
+                ++engine->generation;
+                --generations;
+
+                if((result = gol_engine_track(engine, 1)) != EXIT_SUCCESS) {
+                    break;
+                }
+            }
+            break;
+        default:
+            result = GOL_ERROR(EXIT_FAILURE);
+            break;
+    }
+
+    if(engine->stats && (result == EXIT_SUCCESS)) {
+        gol_engine_measure(engine, &begin, generation);
+    }
+
+    return result;
+}
+
+const uint64_t *
+gol_engine_frame(
+    __inout gol_engine_t *engine,
+    __out size_t *stride
+    )
+{
+    const uint64_t *result = NULL;
+
+    switch(engine->type) {
+        case GOL_ENGINE_DENSE:
+
+            if(gol_dense_verify(&engine->dense) == EXIT_SUCCESS) {
+                *stride = engine->dense.stride;
+                result = engine->dense.previous;
+            }
+            break;
+        case GOL_ENGINE_HASHLIFE:
+            *stride = engine->hashlife.stride;
+            result = gol_hashlife_frame(&engine->hashlife);
+            break;
+        case GOL_ENGINE_SPARSE:
+            *stride = engine->sparse.stride;
+            result = gol_sparse_frame(&engine->sparse);
+            break;
+        default:
+            break;
+    }
+
+    return result;
+}
+
+int
+gol_engine_init(
+    __inout gol_engine_t *engine,
+    __in const gol_config_t *config
+    )
+{
+    int result;
+    gol_config_t restore;
+    gol_snapshot_t snapshot = {};
+
+    if(config->restore) {
+
+        if((result = gol_snapshot_open(&snapshot, config->restore)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+
+        restore = *config;
+        restore.width = snapshot.width;
+        restore.height = snapshot.height;
+        restore.rule = snapshot.rule;
+        restore.pattern = NULL;
+        config = &restore;
+        engine->generation = snapshot.generation;
+    }
+
+    engine->width = config->width;
+    engine->height = config->height;
+
+    switch((engine->type = config->engine)) {
+        case GOL_ENGINE_DENSE:
+            result = gol_dense_init(&engine->dense, config, &snapshot);
+            engine->rule = engine->dense.rule;
+            engine->stride = engine->dense.stride;
+            break;
+        case GOL_ENGINE_HASHLIFE:
+            result = gol_hashlife_init(&engine->hashlife, config, &snapshot);
+            engine->rule = engine->hashlife.rule;
+            engine->stride = engine->hashlife.stride;
+            break;
+        case GOL_ENGINE_SPARSE:
+            result = gol_sparse_init(&engine->sparse, config, &snapshot);
+            engine->rule = engine->sparse.rule;
+            engine->stride = engine->sparse.stride;
+            break;
+        default:
+            result = GOL_ERROR(EXIT_FAILURE);
+            break;
+    }
+
+    if((result == EXIT_SUCCESS) && (engine->type == GOL_ENGINE_DENSE)
+            && (config->stats || config->log || config->period)) {
+        result = gol_dense_verify(&engine->dense);
+    }
+
+    if((result == EXIT_SUCCESS) && (config->stats || config->log)) {
+        engine->stats = true;
+        engine->dense.stats = true;
+        engine->sparse.stats = true;
+        engine->record.generation = engine->generation;
+        engine->record.population = gol_engine_population(engine);
+    }
+
+    if((result == EXIT_SUCCESS) && config->period && (engine->type != GOL_ENGINE_HASHLIFE)) {
+
+        if((result = gol_cycle_init(&engine->cycle, config->period)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+
+        engine->dense.digest = true;
+        engine->sparse.digest = true;
+        engine->digest = gol_engine_digest(engine);
+        gol_cycle_push(&engine->cycle, engine->digest, engine->generation);
+        engine->origin = engine->generation;
+    }
+
+exit:
+    gol_snapshot_close(&snapshot);
+
+    return result;
+}
+
+const uint64_t *
+gol_engine_lend(
+    __inout gol_engine_t *engine,
+    __out size_t *stride,
+    __out bool *lent
+    )
+{
+    const uint64_t *result = NULL;
+
+    *lent = (engine->type == GOL_ENGINE_DENSE);
+
+    if(!*lent) {
+        result = gol_engine_frame(engine, stride);
+    } else if(gol_dense_verify(&engine->dense) == EXIT_SUCCESS) {
+        *stride = engine->dense.stride;
+        result = gol_dense_lend(&engine->dense);
+    }
+
+    return result;
+}
+
+gol_memory_e
+gol_engine_memory(
+    __in const gol_engine_t *engine
+    )
+{
+    return (engine->type == GOL_ENGINE_DENSE) ? gol_dense_memory(&engine->dense) : GOL_MEMORY_HEAP;
+}
+
+uint64_t
+gol_engine_oldest(
+    __in const gol_engine_t *engine
+    )
+{
+    return (engine->type == GOL_ENGINE_DENSE) ? gol_dense_oldest(&engine->dense) : engine->generation;
+}
+
+uint64_t
+gol_engine_population(
+    __in const gol_engine_t *engine
+    )
+{
+    uint64_t result = 0;
+
+    switch(engine->type) {
+        case GOL_ENGINE_DENSE:
+            result = gol_dense_population(&engine->dense);
+            break;
+        case GOL_ENGINE_HASHLIFE:
+            result = gol_hashlife_population(&engine->hashlife);
+            break;
+        case GOL_ENGINE_SPARSE:
+            result = gol_sparse_population(&engine->sparse);
+            break;
+        default:
+            break;
+    }
+
+    return result;
+}
+
+const uint64_t *
+gol_engine_recall(
+    __inout gol_engine_t *engine,
+    __in uint64_t generation,
+    __out size_t *stride
+    )
+{
+    const uint64_t *result = NULL;
+
+    if(generation == engine->generation) {
+        result = gol_engine_frame(engine, stride);
+    } else if(engine->type == GOL_ENGINE_DENSE) {
+        *stride = engine->dense.stride;
+        result = gol_dense_recall(&engine->dense, generation);
+    }
+
+    return result;
+}
+
+void
+gol_engine_release(
+    __inout gol_engine_t *engine
+    )
+{
+
+    if(engine->type == GOL_ENGINE_DENSE) {
+        gol_dense_release(&engine->dense);
+    }
+}
+
+int
+gol_engine_rewind(
+    __inout gol_engine_t *engine,
+    __in uint64_t generation
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    if(generation == engine->generation) {
+        goto exit;
+    }
+
+    if(engine->type != GOL_ENGINE_DENSE) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if((result = gol_dense_rewind(&engine->dense, generation)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    engine->generation = generation;
+
+    if(engine->stats) {
+        engine->record.population = gol_engine_population(engine);
+    }
+
+    if(engine->cycle.limit) {
+        engine->digest = gol_engine_digest(engine);
+        gol_cycle_reset(&engine->cycle);
+        gol_cycle_push(&engine->cycle, engine->digest, engine->generation);
+        engine->origin = engine->generation;
+    }
+
+exit:
+    return result;
+}
+
+uint64_t
+gol_engine_span(
+    __in const gol_engine_t *engine
+    )
+{
+    uint64_t result = 1;
+
+    switch(engine->type) {
+        case GOL_ENGINE_DENSE:
+            result = engine->dense.depth;
+            break;
+        case GOL_ENGINE_HASHLIFE:
+            result = UINT64_C(1) << engine->hashlife.jump;
+            break;
+        default:
+            break;
+    }
+
+    return result;
+}
+
+int
+gol_engine_step(
+    __inout gol_engine_t *engine
+    )
+{
+    struct timespec begin = {};
+    uint64_t generation = engine->generation;
+    int result = EXIT_SUCCESS;
+
+    if(engine->stats) {
+        clock_gettime(CLOCK_MONOTONIC, &begin);
+    }
+
+    switch(engine->type) {
+        case GOL_ENGINE_DENSE:
+
+            if((result = gol_dense_step(&engine->dense)) == EXIT_SUCCESS) {
+                engine->generation += engine->dense.depth;
+                result = gol_engine_track(engine, engine->dense.depth);
+            }
+            break;
+        case GOL_ENGINE_HASHLIFE:
+
+            if((result = gol_hashlife_step(&engine->hashlife)) == EXIT_SUCCESS) {
+                engine->generation += UINT64_C(1) << engine->hashlife.jump;
+            }
+            break;
+        case GOL_ENGINE_SPARSE:
+
+            if((result = gol_sparse_step(&engine->sparse)) == EXIT_SUCCESS) {
+                ++engine->generation;
+                result = gol_engine_track(engine, 1);
+            }
+            break;
+        default:
+            result = GOL_ERROR(EXIT_FAILURE);
+            break;
+    }
+
+    if(engine->stats && (result == EXIT_SUCCESS)) {
+        gol_engine_measure(engine, &begin, generation);
+    }
+
+    return result;
+}
+
+void
+gol_engine_uninit(
+    __inout gol_engine_t *engine
+    )
+{
+
+    gol_cycle_uninit(&engine->cycle);
+
+    switch(engine->type) {
+        case GOL_ENGINE_DENSE:
+            gol_dense_uninit(&engine->dense);
+            break;
+        case GOL_ENGINE_HASHLIFE:
+            gol_hashlife_uninit(&engine->hashlife);
+            break;
+        case GOL_ENGINE_SPARSE:
+            gol_sparse_uninit(&engine->sparse);
+            break;
+        default:
+            break;
+    }
+
+    memset(engine, 0, sizeof(*engine));
+}
+
+int
+gol_engine_write(
+    __inout gol_engine_t *engine,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t x,
+    __in size_t y,
+    __in size_t width,
+    __in size_t height
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    switch(engine->type) {
+        case GOL_ENGINE_DENSE:
+
+            if((result = gol_dense_verify(&engine->dense)) == EXIT_SUCCESS) {
+                gol_dense_write(&engine->dense, word, stride, x, y, width, height);
+            }
+            break;
+        case GOL_ENGINE_HASHLIFE:
+            result = gol_hashlife_write(&engine->hashlife, word, stride, x, y, width, height);
+            break;
+        case GOL_ENGINE_SPARSE:
+            result = gol_sparse_write(&engine->sparse, word, stride, x, y, width, height);
+            break;
+        default:
+            result = GOL_ERROR(EXIT_FAILURE);
+            break;
+    }
+
+    if(engine->stats && (result == EXIT_SUCCESS)) {
+        engine->record.population = gol_engine_population(engine);
+    }
+
+    if(engine->cycle.limit && (result == EXIT_SUCCESS)) {
+        engine->digest = gol_engine_digest(engine);
+        gol_cycle_reset(&engine->cycle);
+        gol_cycle_push(&engine->cycle, engine->digest, engine->generation);
+        engine->origin = engine->generation;
+    }
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
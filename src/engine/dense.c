@@ -0,0 +1,1095 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "../../include/engine/dense.h"
+
+#define BIT_MASK(_X_) \
+    (UINT64_C(1) << ((_X_) & (WORD_BITS - 1)))
+
+#define WORD_OFFSET(_GOL_, _X_, _Y_) \
+    (((_Y_) * (_GOL_)->stride) + ((_X_) / WORD_BITS))
+
+#define HALO_ROW(_GOL_, _ROW_) \
+    (&(_GOL_)->halo[1 + ((_ROW_) * (_GOL_)->stride)])
+
+#define HALO_NORTH 0
+#define HALO_FIRST 1
+#define HALO_LAST 2
+#define HALO_SOUTH 3
+#define HALO_ROWS 4
+
+#define LINE_WORDS (MEMORY_LINE / sizeof(uint64_t))
+
+#define TILE_ROWS 32
+#define TILE_WORDS 8
+
+#define BLOCKED(_GOL_) \
+    (((_GOL_)->depth > 1) && ((_GOL_)->boundary != GOL_BOUNDARY_MIRROR))
+
+#define SLOT(_GOL_, _BACK_) \
+    ((((_GOL_)->head + (_GOL_)->slots) - (_BACK_)) % (_GOL_)->slots)
+
+#define SLOT_NEXT(_GOL_) \
+    (((_GOL_)->head + 1) % (_GOL_)->slots)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static void
+gol_dense_touch(
+    __in void *context,
+    __in size_t index,
+    __in size_t count
+    )
+{
+    gol_dense_t *dense = context;
+    size_t begin = ((dense->tile_rows * index) / count) * TILE_ROWS;
+    size_t end = ((dense->tile_rows * (index + 1)) / count) * TILE_ROWS;
+
+    if(end > dense->height) {
+        end = dense->height;
+    }
+
+    for(size_t plane = 0; plane < dense->planes; ++plane) {
+        size_t offset = ((plane * dense->height) + begin) * dense->stride;
+
+        if(dense->seed && !plane) {
+
+            for(size_t y = begin; y < end; ++y) {
+                uint64_t *row = &dense->previous[y * dense->stride];
+
+                gol_random_fill(&dense->random, row, dense->words, y * dense->words);
+                row[dense->words - 1] &= dense->mask;
+            }
+        } else if(dense->previous != dense->snapshot.word) {
+            memset(&dense->previous[offset], 0, (end - begin) * dense->stride * sizeof(uint64_t));
+        }
+
+        for(size_t slot = 1; slot < dense->slots; ++slot) {
+            memset(&dense->ring[slot][offset], 0, (end - begin) * dense->stride * sizeof(uint64_t));
+        }
+    }
+}
+
+int
+gol_dense_init(
+    __inout gol_dense_t *dense,
+    __in const gol_config_t *config,
+    __inout gol_snapshot_t *snapshot
+    )
+{
+    size_t size;
+    int result = EXIT_SUCCESS;
+
+    if(!config->width || !config->height || (config->boundary >= GOL_BOUNDARY_MAX) || (config->depth > TILE_ROWS)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if((result = gol_rule_parse(&dense->rule, config->rule ? config->rule : RULE_DEFAULT)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    gol_random_init(&dense->random, config->seed, config->density);
+    dense->width = config->width;
+    dense->height = config->height;
+    dense->stride = (((dense->width + WORD_BITS + 1) / WORD_BITS) + LINE_WORDS - 1) & ~(size_t)(LINE_WORDS - 1);
+    dense->words = (dense->width + WORD_BITS - 1) / WORD_BITS;
+    dense->tail = (dense->width - 1) & (WORD_BITS - 1);
+    dense->mask = UINT64_MAX >> ((WORD_BITS - 1) - dense->tail);
+    dense->planes = gol_rule_planes(&dense->rule);
+    dense->kernel = gol_kernel(gol_kernel_best(), &dense->rule);
+    dense->churn = gol_bits_churn();
+    dense->boundary = config->boundary;
+    dense->depth = config->depth ? config->depth : 1;
+    dense->pass = dense->depth;
+    dense->tile_columns = (dense->words + TILE_WORDS - 1) / TILE_WORDS;
+    dense->tile_rows = (dense->height + TILE_ROWS - 1) / TILE_ROWS;
+    dense->slots = (config->history > 2) ? config->history : 2;
+
+    for(uint32_t index = 0; index < 2; ++index) {
+
+        if(!(dense->active[index] = calloc(dense->tile_columns * dense->tile_rows, sizeof(uint8_t)))) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+    }
+
+    memset(dense->active[0], 1, dense->tile_columns * dense->tile_rows);
+
+    if(!(dense->stamp = calloc(dense->tile_columns * dense->tile_rows, sizeof(uint64_t)))
+            || !(dense->memory = calloc(dense->slots, sizeof(gol_memory_t)))
+            || !(dense->ring = calloc(dense->slots, sizeof(uint64_t *)))
+            || !(dense->epoch = calloc(dense->slots, sizeof(uint64_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    size = dense->planes * dense->stride * dense->height * sizeof(uint64_t);
+
+    if(snapshot->word) {
+        dense->generation = snapshot->generation;
+    }
+
+    if(snapshot->word && (snapshot->stride == dense->stride)) {
+        dense->snapshot = *snapshot;
+        dense->ring[0] = dense->snapshot.word;
+        dense->verify = true;
+        memset(snapshot, 0, sizeof(*snapshot));
+    } else if((result = gol_memory_allocate(&dense->memory[0], size, 0)) != EXIT_SUCCESS) {
+        goto exit;
+    } else {
+        dense->ring[0] = dense->memory[0].data;
+    }
+
+    for(size_t slot = 1; slot < dense->slots; ++slot) {
+
+        if((result = gol_memory_allocate(&dense->memory[slot], size, slot * MEMORY_COLOUR)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+
+        dense->ring[slot] = dense->memory[slot].data;
+    }
+
+    dense->previous = dense->ring[0];
+    dense->next = dense->ring[1];
+    dense->epoch[0] = dense->generation;
+    dense->held = 1;
+
+    if(!(dense->halo = calloc((HALO_ROWS * dense->stride) + 2, sizeof(uint64_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if((result = gol_pool_init(&dense->pool, config->threads)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    dense->seed = !snapshot->word && !config->pattern && !dense->snapshot.word;
+    gol_pool_run(&dense->pool, gol_dense_touch, dense);
+
+    if(snapshot->word) {
+
+        if((result = gol_snapshot_verify(snapshot, 0, snapshot->height)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+
+        for(size_t row = 0; row < (dense->planes * dense->height); ++row) {
+            uint64_t *word = &dense->previous[row * dense->stride];
+
+            memcpy(word, &snapshot->word[row * snapshot->stride], dense->words * sizeof(uint64_t));
+            word[dense->words - 1] &= dense->mask;
+        }
+    } else if(config->pattern) {
+
+        if((result = gol_pattern_load(config->pattern, dense->previous, dense->stride, dense->width, dense->height,
+                config->x, config->y)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+    }
+
+    if(BLOCKED(dense)) {
+        dense->block = 2 * dense->planes * (TILE_ROWS + (2 * dense->depth)) * (dense->words + 4);
+
+        if(!(dense->scratch = calloc(dense->pool.count * dense->block, sizeof(uint64_t)))) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+    }
+
+exit:
+    return result;
+}
+
+static inline uint64_t
+gol_dense_cell(
+    __in const uint64_t *row,
+    __in size_t x
+    )
+{
+    return (row[x / WORD_BITS] >> (x & (WORD_BITS - 1))) & 1;
+}
+
+static void
+gol_dense_ghost(
+    __in const gol_dense_t *dense,
+    __inout uint64_t *row,
+    __in bool set
+    )
+{
+    uint64_t east = 0, west = 0;
+    size_t index = dense->width / WORD_BITS;
+
+    if(set) {
+
+        switch(dense->boundary) {
+            case GOL_BOUNDARY_TORUS:
+                east = gol_dense_cell(row, 0);
+                west = gol_dense_cell(row, dense->width - 1);
+                break;
+            case GOL_BOUNDARY_MIRROR:
+                east = gol_dense_cell(row, dense->width - 1);
+                west = gol_dense_cell(row, 0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    __atomic_store_n(&row[-1], (row[-1] & (UINT64_MAX >> 1)) | (west << (WORD_BITS - 1)), __ATOMIC_RELAXED);
+    __atomic_store_n(&row[index], (row[index] & ~BIT_MASK(dense->width)) | (east << (dense->width & (WORD_BITS - 1))),
+        __ATOMIC_RELAXED);
+}
+
+static void
+gol_dense_border(
+    __inout gol_dense_t *dense,
+    __in bool set
+    )
+{
+
+    for(size_t y = 1; (y + 1) < dense->height; ++y) {
+        gol_dense_ghost(dense, &dense->previous[y * dense->stride], set);
+    }
+}
+
+static void
+gol_dense_halo(
+    __inout gol_dense_t *dense
+    )
+{
+    size_t size = dense->stride * sizeof(uint64_t);
+    const uint64_t *first = dense->previous, *last = &dense->previous[(dense->height - 1) * dense->stride];
+
+    memcpy(HALO_ROW(dense, HALO_FIRST), first, size);
+    memcpy(HALO_ROW(dense, HALO_LAST), last, size);
+
+    switch(dense->boundary) {
+        case GOL_BOUNDARY_TORUS:
+            memcpy(HALO_ROW(dense, HALO_NORTH), last, size);
+            memcpy(HALO_ROW(dense, HALO_SOUTH), first, size);
+            break;
+        case GOL_BOUNDARY_MIRROR:
+            memcpy(HALO_ROW(dense, HALO_NORTH), first, size);
+            memcpy(HALO_ROW(dense, HALO_SOUTH), last, size);
+            break;
+        default:
+            memset(HALO_ROW(dense, HALO_NORTH), 0, size);
+            memset(HALO_ROW(dense, HALO_SOUTH), 0, size);
+            break;
+    }
+
+    for(uint32_t row = HALO_NORTH; row < HALO_ROWS; ++row) {
+        gol_dense_ghost(dense, HALO_ROW(dense, row), true);
+    }
+
+    gol_dense_border(dense, true);
+}
+
+static void
+gol_dense_activate(
+    __inout gol_dense_t *dense,
+    __inout uint8_t *active,
+    __in size_t row,
+    __in size_t column
+    )
+{
+    size_t columns[] = { column ? (column - 1) : (dense->tile_columns - 1), column,
+            ((column + 1) < dense->tile_columns) ? (column + 1) : 0 },
+        rows[] = { row ? (row - 1) : (dense->tile_rows - 1), row, ((row + 1) < dense->tile_rows) ? (row + 1) : 0 };
+
+    for(uint32_t y = 0; y < 3; ++y) {
+
+        for(uint32_t x = 0; x < 3; ++x) {
+            __atomic_store_n(&active[(rows[y] * dense->tile_columns) + columns[x]], 1, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+static void
+gol_dense_refresh(
+    __inout gol_dense_t *dense,
+    __in size_t row,
+    __in size_t column
+    )
+{
+    size_t begin = column * TILE_WORDS, end = begin + TILE_WORDS, bottom = (row + 1) * TILE_ROWS;
+
+    if((dense->held < dense->slots)
+            || (dense->stamp[(row * dense->tile_columns) + column] > dense->epoch[SLOT_NEXT(dense)])) {
+
+        if(end > dense->words) {
+            end = dense->words;
+        }
+
+        if(bottom > dense->height) {
+            bottom = dense->height;
+        }
+
+        for(size_t plane = 0; plane < dense->planes; ++plane) {
+
+            for(size_t y = row * TILE_ROWS; y < bottom; ++y) {
+                size_t offset = ((plane * dense->height) + y) * dense->stride;
+
+                memcpy(&dense->next[offset + begin], &dense->previous[offset + begin], (end - begin) * sizeof(uint64_t));
+
+                if(end == dense->words) {
+                    dense->next[offset + end - 1] &= dense->mask;
+                }
+            }
+        }
+    }
+}
+
+static void
+gol_dense_decay(
+    __in const gol_dense_t *dense,
+    __in const uint64_t *previous,
+    __inout uint64_t *next,
+    __in size_t size,
+    __in size_t offset,
+    __in size_t count
+    )
+{
+    uint32_t oldest = dense->rule.states - 2;
+
+    for(size_t index = offset; index < (offset + count); ++index) {
+        uint64_t carry, dying = 0, last = UINT64_MAX, alive = next[index];
+
+        for(size_t plane = 1; plane < dense->planes; ++plane) {
+            uint64_t age = previous[(plane * size) + index];
+
+            dying |= age;
+            last &= ((oldest >> (plane - 1)) & 1) ? age : ~age;
+        }
+
+        last &= dying;
+        carry = dying & ~last;
+
+        for(size_t plane = 1; plane < dense->planes; ++plane) {
+            uint64_t age = previous[(plane * size) + index];
+
+            next[(plane * size) + index] = ((age ^ carry) & ~last) | ((plane == 1) ? (previous[index] & ~alive) : 0);
+            carry &= age;
+        }
+
+        next[index] = alive & ~dying;
+    }
+}
+
+static uint64_t
+gol_dense_step_tile(
+    __in const gol_dense_t *dense,
+    __inout gol_pool_counter_t *counter,
+    __in size_t row,
+    __in size_t column
+    )
+{
+    uint64_t result = 0;
+    size_t begin = column * TILE_WORDS, end = begin + TILE_WORDS, edge, bottom = (row + 1) * TILE_ROWS;
+
+    if(end > dense->words) {
+        end = dense->words;
+    }
+
+    edge = (end == dense->words) ? (end - 1) : end;
+
+    if(bottom > dense->height) {
+        bottom = dense->height;
+    }
+
+    for(size_t y = row * TILE_ROWS; y < bottom; ++y) {
+        uint64_t *next = &dense->next[y * dense->stride];
+        const uint64_t *current = &dense->previous[y * dense->stride],
+            *north = !y ? HALO_ROW(dense, HALO_NORTH) : ((y == 1) ? HALO_ROW(dense, HALO_FIRST) : (current - dense->stride)),
+            *middle = !y ? HALO_ROW(dense, HALO_FIRST) : (((y + 1) == dense->height) ? HALO_ROW(dense, HALO_LAST) : current),
+            *south = ((y + 1) == dense->height) ? HALO_ROW(dense, HALO_SOUTH)
+                : (((y + 2) == dense->height) ? HALO_ROW(dense, HALO_LAST) : (current + dense->stride));
+
+        dense->kernel(&north[begin], &middle[begin], &south[begin], &next[begin], end - begin, &dense->rule);
+
+        if(dense->planes > 1) {
+            gol_dense_decay(dense, dense->previous, dense->next, dense->stride * dense->height, (y * dense->stride) + begin,
+                end - begin);
+        }
+
+        for(size_t plane = 0; plane < dense->planes; ++plane) {
+            size_t offset = plane * dense->stride * dense->height;
+
+            for(size_t index = begin; index < edge; ++index) {
+                result |= next[offset + index] ^ current[offset + index];
+            }
+
+            if(edge < end) {
+                next[offset + edge] &= dense->mask;
+                result |= (next[offset + edge] ^ current[offset + edge]) & dense->mask;
+            }
+
+            if(dense->digest) {
+                counter->digest ^= gol_bits_rehash(&current[offset + begin], &next[offset + begin], end - begin,
+                    (end == dense->words) ? dense->mask : UINT64_MAX, offset + (y * dense->stride) + begin);
+            }
+        }
+
+        if(dense->stats) {
+            dense->churn(&current[begin], &next[begin], end - begin, (end == dense->words) ? dense->mask : UINT64_MAX,
+                &counter->births, &counter->deaths);
+        }
+    }
+
+    return result;
+}
+
+static void
+gol_dense_step_band(
+    __in void *context,
+    __in size_t index,
+    __in size_t count
+    )
+{
+    gol_dense_t *dense = context;
+    gol_pool_counter_t *counter = &dense->pool.counter[index];
+    uint8_t *active = dense->active[0], *changed = dense->active[1];
+    size_t begin = (dense->tile_rows * index) / count, end = (dense->tile_rows * (index + 1)) / count;
+
+    for(size_t row = begin; row < end; ++row) {
+        uint8_t *tile = &active[row * dense->tile_columns];
+
+        for(size_t column = 0; column < dense->tile_columns; ++column) {
+
+            if(!tile[column]) {
+                gol_dense_refresh(dense, row, column);
+            } else if(gol_dense_step_tile(dense, counter, row, column)) {
+                gol_dense_activate(dense, changed, row, column);
+                dense->stamp[(row * dense->tile_columns) + column] = dense->generation + 1;
+
+                if(dense->stats) {
+                    ++counter->tiles;
+                }
+            }
+        }
+    }
+
+    memset(&active[begin * dense->tile_columns], 0, (end - begin) * dense->tile_columns);
+}
+
+static uint64_t
+gol_dense_extract(
+    __in const gol_dense_t *dense,
+    __in const uint64_t *row,
+    __in int64_t x
+    )
+{
+    uint64_t result = 0;
+    int64_t width = dense->width;
+
+    if((x >= 0) && ((x + WORD_BITS) <= width)) {
+        result = row[x / WORD_BITS];
+    } else {
+
+        for(int64_t count = 0, length; count < WORD_BITS; count += length) {
+            int64_t cell = x + count;
+
+            length = WORD_BITS - count;
+
+            if((cell >= 0) && (cell < width)) {
+                length = (length < (WORD_BITS - (cell & (WORD_BITS - 1)))) ? length : (WORD_BITS - (cell & (WORD_BITS - 1)));
+                length = (length < (width - cell)) ? length : (width - cell);
+                result |= ((row[cell / WORD_BITS] >> (cell & (WORD_BITS - 1))) & (UINT64_MAX >> (WORD_BITS - length)))
+                    << count;
+            } else if(dense->boundary == GOL_BOUNDARY_TORUS) {
+                length = 0;
+                x = (((cell % width) + width) % width) - count;
+            } else if((cell < 0) && (-cell < length)) {
+                length = -cell;
+            }
+        }
+    }
+
+    return result;
+}
+
+static uint64_t
+gol_dense_valid(
+    __in const gol_dense_t *dense,
+    __in int64_t x
+    )
+{
+    uint64_t result = UINT64_MAX;
+    int64_t width = dense->width;
+
+    if((x < 0) || (x >= width)) {
+        result = 0;
+    } else if((x + WORD_BITS) > width) {
+        result = UINT64_MAX >> (WORD_BITS - (width - x));
+    }
+
+    return result;
+}
+
+static void
+gol_dense_block_load(
+    __in const gol_dense_t *dense,
+    __inout uint64_t *source,
+    __inout uint64_t *target,
+    __in size_t plane,
+    __in size_t pitch,
+    __in size_t rows,
+    __in int64_t top,
+    __in int64_t left
+    )
+{
+    int64_t height = dense->height;
+
+    for(size_t index = 0; index < dense->planes; ++index) {
+
+        for(size_t row = 0; row < rows; ++row) {
+            int64_t y = top + row;
+            uint64_t *word = &source[(index * plane) + (row * pitch) + 1];
+
+            if((y < 0) || (y >= height)) {
+
+                if(dense->boundary != GOL_BOUNDARY_TORUS) {
+                    memset(word, 0, (pitch - 2) * sizeof(uint64_t));
+                    memset(&target[(index * plane) + (row * pitch) + 1], 0, (pitch - 2) * sizeof(uint64_t));
+                    continue;
+                }
+
+                y = ((y % height) + height) % height;
+            }
+
+            for(size_t column = 0; column < (pitch - 2); ++column) {
+                word[column] = gol_dense_extract(dense, &dense->previous[(index * dense->stride * dense->height)
+                    + (y * dense->stride)], left + (column * WORD_BITS));
+            }
+        }
+    }
+}
+
+static void
+gol_dense_block_span(
+    __inout gol_dense_t *dense,
+    __inout gol_pool_counter_t *counter,
+    __inout uint64_t *scratch,
+    __inout uint8_t *changed,
+    __in size_t row,
+    __in size_t first,
+    __in size_t last
+    )
+{
+    int64_t depth = dense->depth, top = row * TILE_ROWS, bottom = top + TILE_ROWS, low = depth - top, high;
+    size_t begin = first * TILE_WORDS, end = last * TILE_WORDS, count, pitch, plane, rows;
+    uint64_t *source = scratch, *target, *swap, valid[3];
+
+    if(end > dense->words) {
+        end = dense->words;
+    }
+
+    if(bottom > (int64_t)dense->height) {
+        bottom = dense->height;
+    }
+
+    count = (end - begin) + 2;
+    pitch = count + 2;
+    rows = (bottom - top) + (2 * depth);
+    plane = rows * pitch;
+    target = &scratch[dense->planes * plane];
+    high = depth + (dense->height - top);
+    valid[0] = gol_dense_valid(dense, ((int64_t)begin - 1) * WORD_BITS);
+    valid[1] = gol_dense_valid(dense, (end - 1) * WORD_BITS);
+    valid[2] = gol_dense_valid(dense, end * WORD_BITS);
+    gol_dense_block_load(dense, source, target, plane, pitch, rows, top - depth, ((int64_t)begin - 1) * WORD_BITS);
+
+    for(int64_t step = 1; step <= depth; ++step) {
+        int64_t from = step, to = rows - step;
+
+        if(dense->boundary != GOL_BOUNDARY_TORUS) {
+            from = (from > low) ? from : low;
+            to = (to < high) ? to : high;
+        }
+
+        for(int64_t y = from; y < to; ++y) {
+            uint64_t *word = &target[(y * pitch) + 1];
+
+            dense->kernel(&source[((y - 1) * pitch) + 1], &source[(y * pitch) + 1], &source[((y + 1) * pitch) + 1], word,
+                count, &dense->rule);
+
+            if(dense->boundary != GOL_BOUNDARY_TORUS) {
+                word[0] &= valid[0];
+                word[count - 2] &= valid[1];
+                word[count - 1] &= valid[2];
+            }
+
+            if(dense->planes > 1) {
+                gol_dense_decay(dense, source, target, plane, (y * pitch) + 1, count);
+            }
+        }
+
+        swap = source;
+        source = target;
+        target = swap;
+    }
+
+    for(size_t column = first; column < last; ++column) {
+        uint64_t result = 0;
+        size_t left = column * TILE_WORDS, right = left + TILE_WORDS;
+
+        if(right > dense->words) {
+            right = dense->words;
+        }
+
+        for(int64_t y = top; y < bottom; ++y) {
+
+            for(size_t index = 0; index < dense->planes; ++index) {
+                const uint64_t *word = &source[(index * plane) + ((depth + y - top) * pitch) + 2];
+                size_t offset = (index * dense->stride * dense->height) + (y * dense->stride);
+
+                for(size_t x = left; x < right; ++x) {
+                    uint64_t value = word[x - begin];
+
+                    if((x + 1) == dense->words) {
+                        value &= dense->mask;
+                    }
+
+                    result |= value ^ dense->previous[offset + x];
+                    dense->next[offset + x] = value;
+                }
+
+                if(dense->digest) {
+                    counter->digest ^= gol_bits_rehash(&dense->previous[offset + left], &dense->next[offset + left],
+                        right - left, (right == dense->words) ? dense->mask : UINT64_MAX, offset + left);
+                }
+            }
+
+            if(dense->stats) {
+                dense->churn(&dense->previous[(y * dense->stride) + left], &dense->next[(y * dense->stride) + left],
+                    right - left, (right == dense->words) ? dense->mask : UINT64_MAX, &counter->births, &counter->deaths);
+            }
+        }
+
+        if(result) {
+            gol_dense_activate(dense, changed, row, column);
+            dense->stamp[(row * dense->tile_columns) + column] = dense->generation + dense->depth;
+
+            if(dense->stats) {
+                ++counter->tiles;
+            }
+        }
+    }
+}
+
+static void
+gol_dense_block_band(
+    __in void *context,
+    __in size_t index,
+    __in size_t count
+    )
+{
+    gol_dense_t *dense = context;
+    gol_pool_counter_t *counter = &dense->pool.counter[index];
+    uint64_t *scratch = &dense->scratch[index * dense->block];
+    uint8_t *active = dense->active[0], *changed = dense->active[1];
+    size_t begin = (dense->tile_rows * index) / count, end = (dense->tile_rows * (index + 1)) / count;
+
+    for(size_t row = begin; row < end; ++row) {
+        uint8_t *tile = &active[row * dense->tile_columns];
+        size_t column = 0;
+
+        while(column < dense->tile_columns) {
+            size_t first = column;
+
+            while((column < dense->tile_columns) && tile[column]) {
+                ++column;
+            }
+
+            if(column > first) {
+                gol_dense_block_span(dense, counter, scratch, changed, row, first, column);
+            } else {
+                gol_dense_refresh(dense, row, column);
+                ++column;
+            }
+        }
+    }
+
+    memset(&active[begin * dense->tile_columns], 0, (end - begin) * dense->tile_columns);
+}
+
+static void
+gol_dense_verify_band(
+    __in void *context,
+    __in size_t index,
+    __in size_t count
+    )
+{
+    gol_dense_t *dense = context;
+    size_t begin = (dense->tile_rows * index) / count, end = (dense->tile_rows * (index + 1)) / count;
+
+    if(gol_snapshot_verify(&dense->snapshot, begin * TILE_ROWS, (end - begin) * TILE_ROWS) != EXIT_SUCCESS) {
+        __atomic_store_n(&dense->corrupt, true, __ATOMIC_RELAXED);
+    }
+}
+
+static void
+gol_dense_detach(
+    __inout gol_dense_t *dense
+    )
+{
+    size_t slot = SLOT_NEXT(dense);
+
+    if(dense->lent && (dense->ring[slot] == dense->lent)) {
+        gol_memory_t memory = dense->memory[slot];
+
+        dense->memory[slot] = dense->reserve;
+        dense->reserve = memory;
+        dense->ring[slot] = dense->spare;
+        dense->spare = (uint64_t *)dense->lent;
+        dense->next = dense->ring[slot];
+
+        if(dense->held == dense->slots) {
+            --dense->held;
+        }
+    }
+}
+
+static size_t
+gol_dense_find(
+    __in const gol_dense_t *dense,
+    __in uint64_t generation
+    )
+{
+    size_t result = 0;
+
+    while((result < dense->held) && (dense->epoch[SLOT(dense, result)] != generation)) {
+        ++result;
+    }
+
+    return result;
+}
+
+static void
+gol_dense_swap(
+    __inout gol_dense_t *dense
+    )
+{
+    uint8_t *active = dense->active[0];
+
+    dense->active[0] = dense->active[1];
+    dense->active[1] = active;
+    dense->head = SLOT_NEXT(dense);
+    dense->previous = dense->ring[dense->head];
+    dense->next = dense->ring[SLOT_NEXT(dense)];
+    dense->epoch[dense->head] = dense->generation;
+
+    if(dense->held < dense->slots) {
+        ++dense->held;
+    }
+
+    gol_dense_detach(dense);
+}
+
+uint64_t
+gol_dense_digest(
+    __in const gol_dense_t *dense
+    )
+{
+    uint64_t result = 0;
+
+    for(size_t row = 0; row < (dense->planes * dense->height); ++row) {
+        result ^= gol_bits_hash(&dense->previous[row * dense->stride], dense->words, dense->mask, row * dense->stride);
+    }
+
+    return result;
+}
+
+const uint64_t *
+gol_dense_lend(
+    __inout gol_dense_t *dense
+    )
+{
+    const uint64_t *result = NULL;
+
+    if(!dense->spare) {
+
+        if(gol_memory_allocate(&dense->reserve, dense->planes * dense->stride * dense->height * sizeof(uint64_t),
+                dense->slots * MEMORY_COLOUR) != EXIT_SUCCESS) {
+            goto exit;
+        }
+
+        dense->spare = dense->reserve.data;
+    }
+
+    result = dense->lent = dense->previous;
+
+exit:
+    return result;
+}
+
+gol_memory_e
+gol_dense_memory(
+    __in const gol_dense_t *dense
+    )
+{
+    gol_memory_e result = dense->memory[1].mode;
+
+    for(size_t slot = 0; slot < dense->slots; ++slot) {
+
+        if(dense->memory[slot].data && (dense->memory[slot].mode < result)) {
+            result = dense->memory[slot].mode;
+        }
+    }
+
+    return result;
+}
+
+uint64_t
+gol_dense_oldest(
+    __in const gol_dense_t *dense
+    )
+{
+    return dense->epoch[SLOT(dense, dense->held - 1)];
+}
+
+uint64_t
+gol_dense_population(
+    __in const gol_dense_t *dense
+    )
+{
+    uint64_t result = 0;
+
+    for(size_t y = 0; y < dense->height; ++y) {
+        const uint64_t *word = &dense->previous[y * dense->stride];
+
+        for(size_t x = 0; x < (dense->words - 1); ++x) {
+            result += __builtin_popcountll(word[x]);
+        }
+
+        result += __builtin_popcountll(word[dense->words - 1] & dense->mask);
+    }
+
+    return result;
+}
+
+const uint64_t *
+gol_dense_recall(
+    __in const gol_dense_t *dense,
+    __in uint64_t generation
+    )
+{
+    size_t back = gol_dense_find(dense, generation);
+
+    return (back < dense->held) ? dense->ring[SLOT(dense, back)] : NULL;
+}
+
+void
+gol_dense_release(
+    __inout gol_dense_t *dense
+    )
+{
+    dense->lent = NULL;
+}
+
+void
+gol_dense_renumber(
+    __inout gol_dense_t *dense,
+    __in uint64_t generation
+    )
+{
+    dense->generation = generation;
+    dense->epoch[dense->head] = generation;
+    dense->held = 1;
+
+    for(size_t tile = 0; tile < (dense->tile_columns * dense->tile_rows); ++tile) {
+
+        if(dense->stamp[tile] > generation) {
+            dense->stamp[tile] = generation;
+        }
+    }
+}
+
+int
+gol_dense_rewind(
+    __inout gol_dense_t *dense,
+    __in uint64_t generation
+    )
+{
+    size_t back;
+    int result = EXIT_SUCCESS;
+
+    if((back = gol_dense_find(dense, generation)) == dense->held) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    dense->head = SLOT(dense, back);
+    dense->held -= back;
+    dense->previous = dense->ring[dense->head];
+    dense->next = dense->ring[SLOT_NEXT(dense)];
+    dense->generation = generation;
+    gol_dense_detach(dense);
+    memset(dense->active[0], 1, dense->tile_columns * dense->tile_rows);
+
+    for(size_t tile = 0; tile < (dense->tile_columns * dense->tile_rows); ++tile) {
+
+        if(dense->stamp[tile] > generation) {
+            dense->stamp[tile] = generation;
+        }
+    }
+
+exit:
+    return result;
+}
+
+int
+gol_dense_step(
+    __inout gol_dense_t *dense
+    )
+{
+    int result;
+
+    if((result = gol_dense_verify(dense)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    if(dense->pass != dense->depth) {
+        memset(dense->active[0], 1, dense->tile_columns * dense->tile_rows);
+        dense->pass = dense->depth;
+    }
+
+    if(BLOCKED(dense)) {
+        gol_pool_run(&dense->pool, gol_dense_block_band, dense);
+        dense->generation += dense->depth;
+        gol_dense_swap(dense);
+    } else {
+
+        for(size_t generation = 0; generation < dense->depth; ++generation) {
+            gol_dense_halo(dense);
+            gol_pool_run(&dense->pool, gol_dense_step_band, dense);
+            gol_dense_border(dense, false);
+            ++dense->generation;
+            gol_dense_swap(dense);
+        }
+    }
+
+exit:
+    return result;
+}
+
+void
+gol_dense_uninit(
+    __inout gol_dense_t *dense
+    )
+{
+    gol_pool_uninit(&dense->pool);
+
+    for(uint32_t index = 0; index < 2; ++index) {
+
+        if(dense->active[index]) {
+            free(dense->active[index]);
+        }
+    }
+
+    if(dense->halo) {
+        free(dense->halo);
+    }
+
+    if(dense->scratch) {
+        free(dense->scratch);
+    }
+
+    if(dense->memory) {
+
+        for(size_t slot = 0; slot < dense->slots; ++slot) {
+            gol_memory_free(&dense->memory[slot]);
+        }
+
+        free(dense->memory);
+    }
+
+    gol_memory_free(&dense->reserve);
+
+    if(dense->ring) {
+        free(dense->ring);
+    }
+
+    if(dense->epoch) {
+        free(dense->epoch);
+    }
+
+    if(dense->stamp) {
+        free(dense->stamp);
+    }
+
+    gol_snapshot_close(&dense->snapshot);
+    memset(dense, 0, sizeof(*dense));
+}
+
+int
+gol_dense_verify(
+    __inout gol_dense_t *dense
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    if(dense->verify) {
+        gol_pool_run(&dense->pool, gol_dense_verify_band, dense);
+        dense->verify = false;
+    }
+
+    if(dense->corrupt) {
+        result = GOL_ERROR(EXIT_FAILURE);
+    }
+
+    return result;
+}
+
+void
+gol_dense_write(
+    __inout gol_dense_t *dense,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t x,
+    __in size_t y,
+    __in size_t width,
+    __in size_t height
+    )
+{
+
+    for(size_t row = 0; row < height; ++row) {
+        gol_bits_copy(&dense->previous[(y + row) * dense->stride], x, &word[row * stride], 0, width);
+
+        for(size_t plane = 1; plane < dense->planes; ++plane) {
+            gol_bits_fill(&dense->previous[(((plane * dense->height) + y + row) * dense->stride)], x, width, false);
+        }
+    }
+
+    for(size_t row = y / TILE_ROWS; row <= ((y + height - 1) / TILE_ROWS); ++row) {
+
+        for(size_t column = x / (TILE_WORDS * WORD_BITS); column <= ((x + width - 1) / (TILE_WORDS * WORD_BITS)); ++column) {
+            gol_dense_activate(dense, dense->active[0], row, column);
+            dense->stamp[(row * dense->tile_columns) + column] = dense->generation;
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,406 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "../../include/engine/ensemble.h"
+#include "../../include/pattern.h"
+
+#define CELL(_ENSEMBLE_, _BUFFER_, _X_, _Y_) \
+    (&(_BUFFER_)[(((_Y_) + 1) * (_ENSEMBLE_)->pitch) + (((_X_) + 1) * (_ENSEMBLE_)->lanes)])
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static void
+gol_ensemble_border(
+    __inout gol_ensemble_t *ensemble,
+    __inout uint64_t *buffer
+    )
+{
+    size_t bytes = ensemble->lanes * sizeof(uint64_t);
+
+    if(ensemble->boundary == GOL_BOUNDARY_DEAD) {
+        return;
+    }
+
+    for(size_t y = 0; y < ensemble->height; ++y) {
+        uint64_t *west = CELL(ensemble, buffer, -1, y), *east = CELL(ensemble, buffer, ensemble->width, y);
+
+        if(ensemble->boundary == GOL_BOUNDARY_TORUS) {
+            memcpy(west, CELL(ensemble, buffer, ensemble->width - 1, y), bytes);
+            memcpy(east, CELL(ensemble, buffer, 0, y), bytes);
+        } else {
+            memcpy(west, CELL(ensemble, buffer, 0, y), bytes);
+            memcpy(east, CELL(ensemble, buffer, ensemble->width - 1, y), bytes);
+        }
+    }
+
+    bytes = ensemble->pitch * sizeof(uint64_t);
+
+    if(ensemble->boundary == GOL_BOUNDARY_TORUS) {
+        memcpy(CELL(ensemble, buffer, -1, -1), CELL(ensemble, buffer, -1, ensemble->height - 1), bytes);
+        memcpy(CELL(ensemble, buffer, -1, ensemble->height), CELL(ensemble, buffer, -1, 0), bytes);
+    } else {
+        memcpy(CELL(ensemble, buffer, -1, -1), CELL(ensemble, buffer, -1, 0), bytes);
+        memcpy(CELL(ensemble, buffer, -1, ensemble->height), CELL(ensemble, buffer, -1, ensemble->height - 1), bytes);
+    }
+}
+
+static void
+gol_ensemble_match(
+    __inout gol_ensemble_t *ensemble
+    )
+{
+    memset(ensemble->change, 0, ensemble->lanes * sizeof(uint64_t));
+
+    for(size_t y = 0; y < ensemble->height; ++y) {
+        const uint64_t *row = CELL(ensemble, ensemble->previous, 0, y);
+        const uint64_t *origin = CELL(ensemble, ensemble->origin, 0, y);
+
+        for(size_t index = 0; index < (ensemble->width * ensemble->lanes); index += ensemble->lanes) {
+
+            for(size_t lane = 0; lane < ensemble->lanes; ++lane) {
+                ensemble->change[lane] |= row[index + lane] ^ origin[index + lane];
+            }
+        }
+    }
+
+    for(size_t lane = 0; lane < ensemble->lanes; ++lane) {
+        uint64_t match = ~(ensemble->change[lane] | ensemble->done[lane]);
+
+        ensemble->done[lane] |= match;
+
+        for(; match; match &= match - 1) {
+            size_t index = (lane * WORD_BITS) + __builtin_ctzll(match);
+
+            ensemble->cycle[index] = ensemble->generation - ensemble->since;
+            ensemble->stable[index] = ensemble->since;
+            ++ensemble->settled;
+        }
+    }
+
+    if((ensemble->generation - ensemble->since) >= ensemble->period) {
+        memcpy(ensemble->origin, ensemble->previous, (ensemble->height + 2) * ensemble->pitch * sizeof(uint64_t));
+        ensemble->since = ensemble->generation;
+    }
+}
+
+static void
+gol_ensemble_write(
+    __inout gol_ensemble_t *ensemble,
+    __in size_t index,
+    __in const uint64_t *word,
+    __in size_t stride
+    )
+{
+    size_t lane = index / WORD_BITS;
+    uint64_t mask = UINT64_C(1) << (index & (WORD_BITS - 1));
+
+    for(size_t y = 0; y < ensemble->height; ++y) {
+        const uint64_t *row = &word[y * stride];
+
+        for(size_t x = 0; x < ensemble->width; ++x) {
+            uint64_t *cell = &CELL(ensemble, ensemble->previous, x, y)[lane];
+
+            *cell = ((row[x / WORD_BITS] >> (x & (WORD_BITS - 1))) & 1) ? (*cell | mask) : (*cell & ~mask);
+        }
+    }
+}
+
+int
+gol_ensemble_create(
+    __out gol_ensemble_t **ensemble,
+    __in const gol_config_t *config,
+    __in unsigned long count
+    )
+{
+    uint64_t *word = NULL;
+    gol_random_t random;
+    int result = EXIT_SUCCESS;
+    gol_ensemble_t *instance = NULL;
+
+    if(!ensemble || !config || !config->width || !config->height || !count
+            || (config->boundary >= GOL_BOUNDARY_MAX)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!(instance = calloc(1, sizeof(*instance)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if((result = gol_rule_parse(&instance->rule, config->rule ? config->rule : RULE_DEFAULT)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    if(instance->rule.states > 2) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    gol_random_init(&random, config->seed, config->density);
+    instance->width = config->width;
+    instance->height = config->height;
+    instance->words = (instance->width + WORD_BITS - 1) / WORD_BITS;
+    instance->count = count;
+    instance->lanes = (count + WORD_BITS - 1) / WORD_BITS;
+    instance->pitch = (instance->width + 2) * instance->lanes;
+    instance->kernel = gol_kernel_ensemble(gol_kernel_best());
+    instance->boundary = config->boundary;
+    instance->period = config->period;
+
+    if(!(instance->previous = calloc((instance->height + 2) * instance->pitch, sizeof(uint64_t)))
+            || !(instance->next = calloc((instance->height + 2) * instance->pitch, sizeof(uint64_t)))
+            || !(instance->origin = calloc((instance->height + 2) * instance->pitch, sizeof(uint64_t)))
+            || !(instance->change = calloc(instance->lanes, sizeof(uint64_t)))
+            || !(instance->done = calloc(instance->lanes, sizeof(uint64_t)))
+            || !(instance->cycle = calloc(instance->count, sizeof(uint64_t)))
+            || !(instance->stable = calloc(instance->count, sizeof(uint64_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(count & (WORD_BITS - 1)) {
+        instance->done[instance->lanes - 1] = UINT64_MAX << (count & (WORD_BITS - 1));
+    }
+
+    if(config->pattern) {
+
+        if(!(word = calloc(instance->words * instance->height, sizeof(uint64_t)))) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+
+        if((result = gol_pattern_load(config->pattern, word, instance->words, instance->width, instance->height,
+                config->x, config->y)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+
+        for(size_t index = 0; index < instance->count; ++index) {
+            gol_ensemble_write(instance, index, word, instance->words);
+        }
+    } else {
+
+        for(size_t y = 0; y < instance->height; ++y) {
+            uint64_t *row = CELL(instance, instance->previous, 0, y);
+
+            gol_random_fill(&random, row, instance->width * instance->lanes, y * instance->width * instance->lanes);
+
+            for(size_t x = 1; x <= instance->width; ++x) {
+                row[(x * instance->lanes) - 1] &= ~instance->done[instance->lanes - 1];
+            }
+        }
+    }
+
+    memcpy(instance->origin, instance->previous, (instance->height + 2) * instance->pitch * sizeof(uint64_t));
+    *ensemble = instance;
+    instance = NULL;
+
+exit:
+    free(word);
+    gol_ensemble_destroy(instance);
+
+    return result;
+}
+
+void
+gol_ensemble_destroy(
+    __inout gol_ensemble_t *ensemble
+    )
+{
+
+    if(ensemble) {
+        free(ensemble->stable);
+        free(ensemble->cycle);
+        free(ensemble->done);
+        free(ensemble->change);
+        free(ensemble->origin);
+        free(ensemble->next);
+        free(ensemble->previous);
+        free(ensemble);
+    }
+}
+
+const char *
+gol_ensemble_error(
+    __in const gol_ensemble_t *ensemble
+    )
+{
+    return ensemble->error.str;
+}
+
+uint64_t
+gol_ensemble_generation(
+    __in const gol_ensemble_t *ensemble
+    )
+{
+    return ensemble->generation;
+}
+
+int
+gol_ensemble_get(
+    __inout gol_ensemble_t *ensemble,
+    __in unsigned long index,
+    __out uint64_t *word,
+    __in size_t stride
+    )
+{
+    int result = EXIT_SUCCESS;
+    size_t lane = index / WORD_BITS, shift = index & (WORD_BITS - 1);
+
+    if(!word || (index >= ensemble->count) || (stride < ensemble->words)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        gol_error_save(&ensemble->error);
+        goto exit;
+    }
+
+    for(size_t y = 0; y < ensemble->height; ++y) {
+        uint64_t *row = &word[y * stride];
+
+        memset(row, 0, ensemble->words * sizeof(uint64_t));
+
+        for(size_t x = 0; x < ensemble->width; ++x) {
+            uint64_t cell = (CELL(ensemble, ensemble->previous, x, y)[lane] >> shift) & 1;
+
+            row[x / WORD_BITS] |= cell << (x & (WORD_BITS - 1));
+        }
+    }
+
+exit:
+    return result;
+}
+
+int
+gol_ensemble_result(
+    __inout gol_ensemble_t *ensemble,
+    __in unsigned long index,
+    __out uint64_t *population,
+    __out uint64_t *period,
+    __out uint64_t *generation
+    )
+{
+    int result = EXIT_SUCCESS;
+    size_t lane = index / WORD_BITS, shift = index & (WORD_BITS - 1);
+
+    if(!population || !period || !generation || (index >= ensemble->count)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        gol_error_save(&ensemble->error);
+        goto exit;
+    }
+
+    *population = 0;
+
+    for(size_t y = 0; y < ensemble->height; ++y) {
+
+        for(size_t x = 0; x < ensemble->width; ++x) {
+            *population += (CELL(ensemble, ensemble->previous, x, y)[lane] >> shift) & 1;
+        }
+    }
+
+    *period = ensemble->cycle[index];
+    *generation = ensemble->stable[index];
+
+exit:
+    return result;
+}
+
+int
+gol_ensemble_set(
+    __inout gol_ensemble_t *ensemble,
+    __in unsigned long index,
+    __in const uint64_t *word,
+    __in size_t stride
+    )
+{
+    int result = EXIT_SUCCESS;
+    size_t lane = index / WORD_BITS;
+    uint64_t mask = UINT64_C(1) << (index & (WORD_BITS - 1));
+
+    if(!word || (index >= ensemble->count) || (stride < ensemble->words)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        gol_error_save(&ensemble->error);
+        goto exit;
+    }
+
+    gol_ensemble_write(ensemble, index, word, stride);
+
+    if(ensemble->done[lane] & mask) {
+        ensemble->done[lane] &= ~mask;
+        ensemble->cycle[index] = 0;
+        ensemble->stable[index] = 0;
+        --ensemble->settled;
+    }
+
+    memcpy(ensemble->origin, ensemble->previous, (ensemble->height + 2) * ensemble->pitch * sizeof(uint64_t));
+    ensemble->since = ensemble->generation;
+
+exit:
+    return result;
+}
+
+uint64_t
+gol_ensemble_settled(
+    __in const gol_ensemble_t *ensemble
+    )
+{
+    return ensemble->settled;
+}
+
+int
+gol_ensemble_step(
+    __inout gol_ensemble_t *ensemble,
+    __in uint64_t generations
+    )
+{
+
+    for(uint64_t generation = 0; generation < generations; ++generation) {
+        uint64_t *swap;
+
+        if(ensemble->period && (ensemble->settled == ensemble->count)) {
+            break;
+        }
+
+        gol_ensemble_border(ensemble, ensemble->previous);
+
+        for(size_t y = 0; y < ensemble->height; ++y) {
+            const uint64_t *row = CELL(ensemble, ensemble->previous, 0, y);
+
+            ensemble->kernel(row - ensemble->pitch, row, row + ensemble->pitch, CELL(ensemble, ensemble->next, 0, y),
+                ensemble->width * ensemble->lanes, ensemble->lanes, &ensemble->rule);
+        }
+
+        swap = ensemble->previous;
+        ensemble->previous = ensemble->next;
+        ensemble->next = swap;
+        ++ensemble->generation;
+
+        if(ensemble->period) {
+            gol_ensemble_match(ensemble);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,745 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "../../include/engine/hashlife.h"
+
+#define CACHE_DEFAULT 256
+
+#define CHILD(_HASHLIFE_, _INDEX_, _QUADRANT_) \
+    (NODE(_HASHLIFE_, _INDEX_)->child[_QUADRANT_])
+
+#define NODE(_HASHLIFE_, _INDEX_) \
+    (&(_HASHLIFE_)->node[_INDEX_])
+
+#define NODE_CAPACITY 65536
+
+#define NODE_DEAD 0
+#define NODE_LIVE 1
+#define NODE_NONE UINT32_MAX
+
+#define NORTH_WEST 0
+#define NORTH_EAST 1
+#define SOUTH_WEST 2
+#define SOUTH_EAST 3
+
+typedef struct {
+    const uint64_t *word;
+    size_t stride;
+    int64_t x;
+    int64_t y;
+    int64_t width;
+    int64_t height;
+} gol_hashlife_region_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static uint32_t
+gol_hashlife_allocate(
+    __inout gol_hashlife_t *hashlife
+    )
+{
+    uint32_t result = NODE_NONE;
+
+    if(hashlife->free != NODE_NONE) {
+        result = hashlife->free;
+        hashlife->free = NODE(hashlife, result)->next;
+    } else {
+
+        if(hashlife->used == hashlife->capacity) {
+            size_t capacity = hashlife->capacity * 2;
+            gol_hashlife_node_t *node;
+
+            if(capacity > hashlife->limit) {
+                capacity = hashlife->limit;
+            }
+
+            if((capacity == hashlife->capacity)
+                    || !(node = realloc(hashlife->node, capacity * sizeof(*node)))) {
+                goto exit;
+            }
+
+            hashlife->node = node;
+            hashlife->capacity = capacity;
+        }
+
+        result = hashlife->used++;
+    }
+
+    ++hashlife->count;
+
+exit:
+    return result;
+}
+
+static uint64_t
+gol_hashlife_hash(
+    __in const uint32_t *child
+    )
+{
+    return ((child[NORTH_WEST] * UINT64_C(0x9E3779B97F4A7C15)) ^ (child[NORTH_EAST] * UINT64_C(0xC2B2AE3D27D4EB4F))
+        ^ (child[SOUTH_WEST] * UINT64_C(0x165667B19E3779F9)) ^ (child[SOUTH_EAST] * UINT64_C(0x27D4EB2F165667C5))) >> 17;
+}
+
+static uint32_t
+gol_hashlife_join(
+    __inout gol_hashlife_t *hashlife,
+    __in uint32_t north_west,
+    __in uint32_t north_east,
+    __in uint32_t south_west,
+    __in uint32_t south_east
+    )
+{
+    uint32_t child[] = { north_west, north_east, south_west, south_east }, result;
+    uint64_t hash = gol_hashlife_hash(child) & (hashlife->buckets - 1);
+    gol_hashlife_node_t *node;
+
+    for(result = hashlife->bucket[hash]; result != NODE_NONE; result = NODE(hashlife, result)->next) {
+
+        if(!memcmp(NODE(hashlife, result)->child, child, sizeof(child))) {
+            goto exit;
+        }
+    }
+
+    if((result = gol_hashlife_allocate(hashlife)) == NODE_NONE) {
+        hashlife->failed = true;
+        result = NODE_DEAD;
+        goto exit;
+    }
+
+    node = NODE(hashlife, result);
+    memcpy(node->child, child, sizeof(child));
+    node->level = NODE(hashlife, north_west)->level + 1;
+    node->population = NODE(hashlife, north_west)->population + NODE(hashlife, north_east)->population
+        + NODE(hashlife, south_west)->population + NODE(hashlife, south_east)->population;
+    node->result = NODE_NONE;
+    node->jump = 0;
+    node->mark = false;
+    node->next = hashlife->bucket[hash];
+    hashlife->bucket[hash] = result;
+
+exit:
+    return result;
+}
+
+static uint32_t
+gol_hashlife_empty(
+    __inout gol_hashlife_t *hashlife,
+    __in uint32_t level
+    )
+{
+
+    if(hashlife->empty[level] == NODE_NONE) {
+        uint32_t child = gol_hashlife_empty(hashlife, level - 1), result;
+
+        result = gol_hashlife_join(hashlife, child, child, child, child);
+
+        if(hashlife->failed) {
+            return result;
+        }
+
+        hashlife->empty[level] = result;
+    }
+
+    return hashlife->empty[level];
+}
+
+static uint32_t
+gol_hashlife_base(
+    __inout gol_hashlife_t *hashlife,
+    __in uint32_t index
+    )
+{
+    uint16_t cells = 0;
+    uint32_t child[4];
+
+    for(uint32_t quadrant = NORTH_WEST; quadrant <= SOUTH_EAST; ++quadrant) {
+        uint32_t sub = CHILD(hashlife, index, quadrant);
+
+        for(uint32_t leaf = NORTH_WEST; leaf <= SOUTH_EAST; ++leaf) {
+
+            if(CHILD(hashlife, sub, leaf) == NODE_LIVE) {
+                cells |= 1 << (((((quadrant >> 1) * 2) + (leaf >> 1)) * 4) + ((quadrant & 1) * 2) + (leaf & 1));
+            }
+        }
+    }
+
+    for(uint32_t quadrant = NORTH_WEST; quadrant <= SOUTH_EAST; ++quadrant) {
+        uint32_t count = 0, set, x = 1 + (quadrant & 1), y = 1 + (quadrant >> 1);
+
+        for(uint32_t row = y - 1; row <= y + 1; ++row) {
+
+            for(uint32_t column = x - 1; column <= x + 1; ++column) {
+
+                if(((row != y) || (column != x)) && (cells & (1 << ((row * 4) + column)))) {
+                    ++count;
+                }
+            }
+        }
+
+        set = (cells & (1 << ((y * 4) + x))) ? hashlife->rule.survival : hashlife->rule.birth;
+        child[quadrant] = ((set >> count) & 1) ? NODE_LIVE : NODE_DEAD;
+    }
+
+    return gol_hashlife_join(hashlife, child[NORTH_WEST], child[NORTH_EAST], child[SOUTH_WEST], child[SOUTH_EAST]);
+}
+
+static uint32_t
+gol_hashlife_successor(
+    __inout gol_hashlife_t *hashlife,
+    __in uint32_t index,
+    __in uint32_t jump
+    )
+{
+    gol_hashlife_node_t *node = NODE(hashlife, index);
+    uint32_t level = node->level, result, sub[9];
+
+    if(hashlife->failed) {
+        return NODE_DEAD;
+    }
+
+    if(jump > (level - 2)) {
+        jump = level - 2;
+    }
+
+    if(!node->population) {
+        return gol_hashlife_empty(hashlife, level - 1);
+    }
+
+    if((node->result != NODE_NONE) && (node->jump == jump)) {
+        return node->result;
+    }
+
+    if(level == 2) {
+        result = gol_hashlife_base(hashlife, index);
+    } else {
+        uint32_t north_west = node->child[NORTH_WEST], north_east = node->child[NORTH_EAST],
+            south_west = node->child[SOUTH_WEST], south_east = node->child[SOUTH_EAST];
+
+        sub[0] = north_west;
+        sub[1] = gol_hashlife_join(hashlife, CHILD(hashlife, north_west, NORTH_EAST), CHILD(hashlife, north_east, NORTH_WEST),
+            CHILD(hashlife, north_west, SOUTH_EAST), CHILD(hashlife, north_east, SOUTH_WEST));
+        sub[2] = north_east;
+        sub[3] = gol_hashlife_join(hashlife, CHILD(hashlife, north_west, SOUTH_WEST), CHILD(hashlife, north_west, SOUTH_EAST),
+            CHILD(hashlife, south_west, NORTH_WEST), CHILD(hashlife, south_west, NORTH_EAST));
+        sub[4] = gol_hashlife_join(hashlife, CHILD(hashlife, north_west, SOUTH_EAST), CHILD(hashlife, north_east, SOUTH_WEST),
+            CHILD(hashlife, south_west, NORTH_EAST), CHILD(hashlife, south_east, NORTH_WEST));
+        sub[5] = gol_hashlife_join(hashlife, CHILD(hashlife, north_east, SOUTH_WEST), CHILD(hashlife, north_east, SOUTH_EAST),
+            CHILD(hashlife, south_east, NORTH_WEST), CHILD(hashlife, south_east, NORTH_EAST));
+        sub[6] = south_west;
+        sub[7] = gol_hashlife_join(hashlife, CHILD(hashlife, south_west, NORTH_EAST), CHILD(hashlife, south_east, NORTH_WEST),
+            CHILD(hashlife, south_west, SOUTH_EAST), CHILD(hashlife, south_east, SOUTH_WEST));
+        sub[8] = south_east;
+
+        for(uint32_t position = 0; position < 9; ++position) {
+            sub[position] = gol_hashlife_successor(hashlife, sub[position], jump);
+        }
+
+        if(jump < (level - 2)) {
+            result = gol_hashlife_join(hashlife,
+                gol_hashlife_join(hashlife, CHILD(hashlife, sub[0], SOUTH_EAST), CHILD(hashlife, sub[1], SOUTH_WEST),
+                    CHILD(hashlife, sub[3], NORTH_EAST), CHILD(hashlife, sub[4], NORTH_WEST)),
+                gol_hashlife_join(hashlife, CHILD(hashlife, sub[1], SOUTH_EAST), CHILD(hashlife, sub[2], SOUTH_WEST),
+                    CHILD(hashlife, sub[4], NORTH_EAST), CHILD(hashlife, sub[5], NORTH_WEST)),
+                gol_hashlife_join(hashlife, CHILD(hashlife, sub[3], SOUTH_EAST), CHILD(hashlife, sub[4], SOUTH_WEST),
+                    CHILD(hashlife, sub[6], NORTH_EAST), CHILD(hashlife, sub[7], NORTH_WEST)),
+                gol_hashlife_join(hashlife, CHILD(hashlife, sub[4], SOUTH_EAST), CHILD(hashlife, sub[5], SOUTH_WEST),
+                    CHILD(hashlife, sub[7], NORTH_EAST), CHILD(hashlife, sub[8], NORTH_WEST)));
+        } else {
+            uint32_t quadrant[4];
+
+            quadrant[NORTH_WEST] = gol_hashlife_join(hashlife, sub[0], sub[1], sub[3], sub[4]);
+            quadrant[NORTH_EAST] = gol_hashlife_join(hashlife, sub[1], sub[2], sub[4], sub[5]);
+            quadrant[SOUTH_WEST] = gol_hashlife_join(hashlife, sub[3], sub[4], sub[6], sub[7]);
+            quadrant[SOUTH_EAST] = gol_hashlife_join(hashlife, sub[4], sub[5], sub[7], sub[8]);
+
+            for(uint32_t position = NORTH_WEST; position <= SOUTH_EAST; ++position) {
+                quadrant[position] = gol_hashlife_successor(hashlife, quadrant[position], jump);
+            }
+
+            result = gol_hashlife_join(hashlife, quadrant[NORTH_WEST], quadrant[NORTH_EAST],
+                quadrant[SOUTH_WEST], quadrant[SOUTH_EAST]);
+        }
+    }
+
+    if(!hashlife->failed) {
+        node = NODE(hashlife, index);
+        node->result = result;
+        node->jump = jump;
+    }
+
+    return result;
+}
+
+static uint32_t
+gol_hashlife_centre(
+    __inout gol_hashlife_t *hashlife,
+    __in uint32_t index
+    )
+{
+    uint32_t empty = gol_hashlife_empty(hashlife, NODE(hashlife, index)->level - 1);
+
+    return gol_hashlife_join(hashlife,
+        gol_hashlife_join(hashlife, empty, empty, empty, CHILD(hashlife, index, NORTH_WEST)),
+        gol_hashlife_join(hashlife, empty, empty, CHILD(hashlife, index, NORTH_EAST), empty),
+        gol_hashlife_join(hashlife, empty, CHILD(hashlife, index, SOUTH_WEST), empty, empty),
+        gol_hashlife_join(hashlife, CHILD(hashlife, index, SOUTH_EAST), empty, empty, empty));
+}
+
+static bool
+gol_hashlife_padded(
+    __in const gol_hashlife_t *hashlife,
+    __in uint32_t index
+    )
+{
+    bool result = true;
+
+    for(uint32_t quadrant = NORTH_WEST; quadrant <= SOUTH_EAST; ++quadrant) {
+        uint32_t child = CHILD(hashlife, index, quadrant), inner = SOUTH_EAST - quadrant;
+
+        if(NODE(hashlife, child)->population != NODE(hashlife, CHILD(hashlife, CHILD(hashlife, child, inner), inner))->population) {
+            result = false;
+            break;
+        }
+    }
+
+    return result;
+}
+
+static void
+gol_hashlife_mark(
+    __inout gol_hashlife_t *hashlife,
+    __in uint32_t index
+    )
+{
+    gol_hashlife_node_t *node = NODE(hashlife, index);
+
+    if(!node->mark) {
+        node->mark = true;
+
+        if(node->level) {
+
+            for(uint32_t quadrant = NORTH_WEST; quadrant <= SOUTH_EAST; ++quadrant) {
+                gol_hashlife_mark(hashlife, node->child[quadrant]);
+            }
+        }
+    }
+}
+
+static void
+gol_hashlife_collect(
+    __inout gol_hashlife_t *hashlife
+    )
+{
+    gol_hashlife_mark(hashlife, NODE_DEAD);
+    gol_hashlife_mark(hashlife, NODE_LIVE);
+    gol_hashlife_mark(hashlife, hashlife->root);
+
+    for(uint32_t level = 0; level <= HASHLIFE_LEVEL_MAX; ++level) {
+
+        if(hashlife->empty[level] != NODE_NONE) {
+            gol_hashlife_mark(hashlife, hashlife->empty[level]);
+        }
+    }
+
+    memset(hashlife->bucket, 0xFF, hashlife->buckets * sizeof(uint32_t));
+    hashlife->free = NODE_NONE;
+    hashlife->count = 0;
+
+    for(uint32_t index = hashlife->used; index-- > 0;) {
+        gol_hashlife_node_t *node = NODE(hashlife, index);
+
+        if(node->mark) {
+            ++hashlife->count;
+
+            if((node->result != NODE_NONE) && !NODE(hashlife, node->result)->mark) {
+                node->result = NODE_NONE;
+            }
+
+            if(node->level) {
+                uint64_t hash = gol_hashlife_hash(node->child) & (hashlife->buckets - 1);
+
+                node->next = hashlife->bucket[hash];
+                hashlife->bucket[hash] = index;
+            }
+        } else {
+            node->next = hashlife->free;
+            hashlife->free = index;
+        }
+    }
+
+    for(uint32_t index = 0; index < hashlife->used; ++index) {
+        NODE(hashlife, index)->mark = false;
+    }
+}
+
+static uint32_t
+gol_hashlife_build(
+    __inout gol_hashlife_t *hashlife,
+    __in uint32_t level,
+    __in uint64_t x,
+    __in uint64_t y
+    )
+{
+    uint64_t half;
+
+    if((x >= hashlife->width) || (y >= hashlife->height)) {
+        return gol_hashlife_empty(hashlife, level);
+    }
+
+    if(!level) {
+        return ((hashlife->frame[(y * hashlife->stride) + (x / WORD_BITS)] >> (x & (WORD_BITS - 1))) & 1) ? NODE_LIVE : NODE_DEAD;
+    }
+
+    half = UINT64_C(1) << (level - 1);
+
+    return gol_hashlife_join(hashlife, gol_hashlife_build(hashlife, level - 1, x, y),
+        gol_hashlife_build(hashlife, level - 1, x + half, y), gol_hashlife_build(hashlife, level - 1, x, y + half),
+        gol_hashlife_build(hashlife, level - 1, x + half, y + half));
+}
+
+static uint32_t
+gol_hashlife_place(
+    __inout gol_hashlife_t *hashlife,
+    __in const gol_hashlife_region_t *region,
+    __in uint32_t index,
+    __in int64_t x,
+    __in int64_t y
+    )
+{
+    uint32_t child[4];
+    int64_t half, size = INT64_C(1) << NODE(hashlife, index)->level;
+
+    if(hashlife->failed || (x >= (region->x + region->width)) || (y >= (region->y + region->height))
+            || ((x + size) <= region->x) || ((y + size) <= region->y)) {
+        return index;
+    }
+
+    if(size == 1) {
+        x -= region->x;
+        y -= region->y;
+
+        return ((region->word[(y * region->stride) + (x / WORD_BITS)] >> (x & (WORD_BITS - 1))) & 1) ? NODE_LIVE : NODE_DEAD;
+    }
+
+    half = size >> 1;
+    memcpy(child, NODE(hashlife, index)->child, sizeof(child));
+
+    for(uint32_t quadrant = NORTH_WEST; quadrant <= SOUTH_EAST; ++quadrant) {
+        child[quadrant] = gol_hashlife_place(hashlife, region, child[quadrant], x + ((quadrant & 1) * half),
+            y + ((quadrant >> 1) * half));
+    }
+
+    return gol_hashlife_join(hashlife, child[NORTH_WEST], child[NORTH_EAST], child[SOUTH_WEST], child[SOUTH_EAST]);
+}
+
+static void
+gol_hashlife_render(
+    __inout gol_hashlife_t *hashlife,
+    __in uint32_t index,
+    __in int64_t x,
+    __in int64_t y
+    )
+{
+    const gol_hashlife_node_t *node = NODE(hashlife, index);
+    int64_t size = INT64_C(1) << node->level;
+
+    if(!node->population || (x >= (int64_t)hashlife->width) || (y >= (int64_t)hashlife->height)
+            || ((x + size) <= 0) || ((y + size) <= 0)) {
+        return;
+    }
+
+    if(!node->level) {
+        hashlife->frame[(y * hashlife->stride) + (x / WORD_BITS)] |= UINT64_C(1) << (x & (WORD_BITS - 1));
+    } else {
+        size >>= 1;
+
+        for(uint32_t quadrant = NORTH_WEST; quadrant <= SOUTH_EAST; ++quadrant) {
+            gol_hashlife_render(hashlife, node->child[quadrant], x + ((quadrant & 1) * size), y + ((quadrant >> 1) * size));
+        }
+    }
+}
+
+const uint64_t *
+gol_hashlife_frame(
+    __inout gol_hashlife_t *hashlife
+    )
+{
+    memset(hashlife->frame, 0, hashlife->stride * hashlife->height * sizeof(uint64_t));
+    gol_hashlife_render(hashlife, hashlife->root, hashlife->x, hashlife->y);
+
+    return hashlife->frame;
+}
+
+int
+gol_hashlife_init(
+    __inout gol_hashlife_t *hashlife,
+    __in const gol_config_t *config,
+    __inout gol_snapshot_t *snapshot
+    )
+{
+    uint32_t level = 3;
+    int result = EXIT_SUCCESS;
+
+    if(!config->width || !config->height) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if((result = gol_rule_parse(&hashlife->rule, config->rule ? config->rule : RULE_DEFAULT)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    if((hashlife->rule.birth & 1) || (hashlife->rule.states > 2)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    hashlife->width = config->width;
+    hashlife->height = config->height;
+    hashlife->stride = (hashlife->width + WORD_BITS - 1) / WORD_BITS;
+    hashlife->jump = (config->jump < (HASHLIFE_LEVEL_MAX - 2)) ? config->jump : (HASHLIFE_LEVEL_MAX - 2);
+    hashlife->limit = ((config->cache ? config->cache : CACHE_DEFAULT) << 20) / (sizeof(gol_hashlife_node_t) + sizeof(uint32_t));
+    hashlife->free = NODE_NONE;
+
+    if(hashlife->limit >= NODE_NONE) {
+        hashlife->limit = NODE_NONE - 1;
+    }
+
+    for(hashlife->buckets = 1; (hashlife->buckets << 1) <= hashlife->limit; hashlife->buckets <<= 1);
+    hashlife->capacity = (hashlife->limit < NODE_CAPACITY) ? hashlife->limit : NODE_CAPACITY;
+
+    if(hashlife->capacity < 2) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!(hashlife->frame = calloc(hashlife->stride * hashlife->height, sizeof(uint64_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!(hashlife->bucket = malloc(hashlife->buckets * sizeof(uint32_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!(hashlife->node = calloc(hashlife->capacity, sizeof(gol_hashlife_node_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    memset(hashlife->bucket, 0xFF, hashlife->buckets * sizeof(uint32_t));
+    memset(hashlife->empty, 0xFF, sizeof(hashlife->empty));
+    hashlife->empty[0] = NODE_DEAD;
+    NODE(hashlife, NODE_DEAD)->result = NODE_NONE;
+    NODE(hashlife, NODE_LIVE)->result = NODE_NONE;
+    NODE(hashlife, NODE_LIVE)->population = 1;
+    hashlife->used = 2;
+    hashlife->count = 2;
+
+    if(snapshot->word) {
+
+        if((result = gol_snapshot_verify(snapshot, 0, snapshot->height)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+
+        for(size_t y = 0; y < hashlife->height; ++y) {
+            memcpy(&hashlife->frame[y * hashlife->stride], &snapshot->word[y * snapshot->stride],
+                hashlife->stride * sizeof(uint64_t));
+        }
+    } else if(config->pattern) {
+
+        if((result = gol_pattern_load(config->pattern, hashlife->frame, hashlife->stride, hashlife->width,
+                hashlife->height, config->x, config->y)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+    } else {
+        gol_random_t random;
+        uint64_t mask = UINT64_MAX >> ((WORD_BITS - 1) - ((hashlife->width - 1) & (WORD_BITS - 1)));
+
+        gol_random_init(&random, config->seed, config->density);
+        gol_random_fill(&random, hashlife->frame, hashlife->stride * hashlife->height, 0);
+
+        for(size_t y = 0; y < hashlife->height; ++y) {
+            hashlife->frame[((y + 1) * hashlife->stride) - 1] &= mask;
+        }
+    }
+
+    while(((UINT64_C(1) << level) < hashlife->width) || ((UINT64_C(1) << level) < hashlife->height)) {
+        ++level;
+    }
+
+    hashlife->root = gol_hashlife_build(hashlife, level, 0, 0);
+
+    if(hashlife->failed) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+exit:
+    return result;
+}
+
+uint64_t
+gol_hashlife_population(
+    __in const gol_hashlife_t *hashlife
+    )
+{
+    return NODE(hashlife, hashlife->root)->population;
+}
+
+int
+gol_hashlife_step(
+    __inout gol_hashlife_t *hashlife
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    for(uint32_t attempt = 0;; ++attempt) {
+        uint32_t root = hashlife->root;
+        int64_t x = hashlife->x, y = hashlife->y;
+
+        if(attempt || (hashlife->count > (hashlife->limit / 2))) {
+            gol_hashlife_collect(hashlife);
+        }
+
+        hashlife->failed = false;
+
+        while(!hashlife->failed && ((NODE(hashlife, root)->level < (hashlife->jump + 1))
+                || !gol_hashlife_padded(hashlife, root))) {
+            int64_t half = INT64_C(1) << (NODE(hashlife, root)->level - 1);
+
+            if(NODE(hashlife, root)->level >= (HASHLIFE_LEVEL_MAX - 1)) {
+                result = GOL_ERROR(EXIT_FAILURE);
+                goto exit;
+            }
+
+            root = gol_hashlife_centre(hashlife, root);
+            x -= half;
+            y -= half;
+        }
+
+        root = gol_hashlife_successor(hashlife, gol_hashlife_centre(hashlife, root), hashlife->jump);
+
+        if(!hashlife->failed) {
+            hashlife->root = root;
+            hashlife->x = x;
+            hashlife->y = y;
+            goto exit;
+        }
+
+        if(attempt) {
+
+            if(!hashlife->jump) {
+                break;
+            }
+
+            hashlife->jump /= 2;
+        }
+    }
+
+    result = GOL_ERROR(EXIT_FAILURE);
+
+exit:
+    return result;
+}
+
+void
+gol_hashlife_uninit(
+    __inout gol_hashlife_t *hashlife
+    )
+{
+
+    if(hashlife->node) {
+        free(hashlife->node);
+    }
+
+    if(hashlife->bucket) {
+        free(hashlife->bucket);
+    }
+
+    if(hashlife->frame) {
+        free(hashlife->frame);
+    }
+
+    memset(hashlife, 0, sizeof(*hashlife));
+}
+
+int
+gol_hashlife_write(
+    __inout gol_hashlife_t *hashlife,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t x,
+    __in size_t y,
+    __in size_t width,
+    __in size_t height
+    )
+{
+    int result = EXIT_SUCCESS;
+    const gol_hashlife_region_t region = { .word = word, .stride = stride, .x = x, .y = y, .width = width, .height = height };
+
+    for(uint32_t attempt = 0; attempt < 2; ++attempt) {
+        uint32_t root = hashlife->root;
+        int64_t left = hashlife->x, top = hashlife->y;
+
+        if(attempt || (hashlife->count > (hashlife->limit / 2))) {
+            gol_hashlife_collect(hashlife);
+        }
+
+        hashlife->failed = false;
+
+        while(!hashlife->failed && ((left > region.x) || (top > region.y)
+                || ((left + (INT64_C(1) << NODE(hashlife, root)->level)) < (region.x + region.width))
+                || ((top + (INT64_C(1) << NODE(hashlife, root)->level)) < (region.y + region.height)))) {
+            int64_t half = INT64_C(1) << (NODE(hashlife, root)->level - 1);
+
+            if(NODE(hashlife, root)->level >= (HASHLIFE_LEVEL_MAX - 1)) {
+                result = GOL_ERROR(EXIT_FAILURE);
+                goto exit;
+            }
+
+            root = gol_hashlife_centre(hashlife, root);
+            left -= half;
+            top -= half;
+        }
+
+        root = gol_hashlife_place(hashlife, &region, root, left, top);
+
+        if(!hashlife->failed) {
+            hashlife->root = root;
+            hashlife->x = left;
+            hashlife->y = top;
+            goto exit;
+        }
+    }
+
+    result = GOL_ERROR(EXIT_FAILURE);
+
+exit:
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
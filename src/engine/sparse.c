@@ -0,0 +1,630 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "../../include/engine/sparse.h"
+
+#define SPARSE_BUCKETS 64
+#define SPARSE_IDLE 8
+
+#define NORTH 0
+#define NORTH_EAST 1
+#define EAST 2
+#define SOUTH_EAST 3
+#define SOUTH 4
+#define SOUTH_WEST 5
+#define WEST 6
+#define NORTH_WEST 7
+
+#define OPPOSITE(_DIRECTION_) \
+    (((_DIRECTION_) + 4) & 7)
+
+#define CHUNK_POSITION(_CHUNK_) \
+    (((((uint64_t)(uint32_t)(_CHUNK_)->x) << 32) | (uint32_t)(_CHUNK_)->y) * SPARSE_ROWS)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static const int32_t OFFSET[][2] = {
+    { 0, -1 }, { 1, -1 }, { 1, 0 }, { 1, 1 }, { 0, 1 }, { -1, 1 }, { -1, 0 }, { -1, -1 },
+    };
+
+static const uint64_t ZERO[SPARSE_ROWS] = {};
+
+static uint64_t
+gol_sparse_hash(
+    __in const gol_sparse_t *sparse,
+    __in int64_t x,
+    __in int64_t y
+    )
+{
+    return ((((uint32_t)x * UINT64_C(0x9E3779B97F4A7C15)) ^ ((uint32_t)y * UINT64_C(0xC2B2AE3D27D4EB4F))) >> 17)
+        & (sparse->buckets - 1);
+}
+
+static gol_sparse_chunk_t *
+gol_sparse_find(
+    __in const gol_sparse_t *sparse,
+    __in int64_t x,
+    __in int64_t y
+    )
+{
+    gol_sparse_chunk_t *result;
+
+    for(result = sparse->bucket[gol_sparse_hash(sparse, x, y)]; result; result = result->next) {
+
+        if((result->x == x) && (result->y == y)) {
+            break;
+        }
+    }
+
+    return result;
+}
+
+static int
+gol_sparse_rehash(
+    __inout gol_sparse_t *sparse,
+    __in size_t buckets
+    )
+{
+    int result = EXIT_SUCCESS;
+    gol_sparse_chunk_t **bucket;
+
+    if(!(bucket = calloc(buckets, sizeof(*bucket)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    free(sparse->bucket);
+    sparse->bucket = bucket;
+    sparse->buckets = buckets;
+
+    for(size_t index = 0; index < sparse->count; ++index) {
+        gol_sparse_chunk_t *chunk = sparse->chunk[index];
+        uint64_t hash = gol_sparse_hash(sparse, chunk->x, chunk->y);
+
+        chunk->next = sparse->bucket[hash];
+        sparse->bucket[hash] = chunk;
+    }
+
+exit:
+    return result;
+}
+
+static int
+gol_sparse_resize(
+    __inout gol_sparse_t *sparse,
+    __in size_t capacity
+    )
+{
+    int result = EXIT_SUCCESS;
+    gol_sparse_chunk_t **chunk;
+
+    if(!(chunk = realloc(sparse->chunk, capacity * sizeof(*chunk)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    sparse->chunk = chunk;
+    sparse->capacity = capacity;
+
+exit:
+    return result;
+}
+
+static gol_sparse_chunk_t *
+gol_sparse_create(
+    __inout gol_sparse_t *sparse,
+    __in int64_t x,
+    __in int64_t y
+    )
+{
+    uint64_t hash;
+    gol_sparse_chunk_t *result = NULL;
+
+    if((x < INT32_MIN) || (x > INT32_MAX) || (y < INT32_MIN) || (y > INT32_MAX)) {
+        goto exit;
+    }
+
+    if((sparse->count == sparse->capacity) && (gol_sparse_resize(sparse, sparse->capacity * 2) != EXIT_SUCCESS)) {
+        goto exit;
+    }
+
+    if((sparse->count == sparse->buckets) && (gol_sparse_rehash(sparse, sparse->buckets * 2) != EXIT_SUCCESS)) {
+        goto exit;
+    }
+
+    if(!(result = calloc(1, sizeof(*result)))) {
+        goto exit;
+    }
+
+    result->x = x;
+    result->y = y;
+    hash = gol_sparse_hash(sparse, x, y);
+    result->next = sparse->bucket[hash];
+    sparse->bucket[hash] = result;
+
+    for(uint32_t direction = NORTH; direction <= NORTH_WEST; ++direction) {
+        gol_sparse_chunk_t *neighbour;
+
+        if((neighbour = gol_sparse_find(sparse, x + OFFSET[direction][0], y + OFFSET[direction][1]))) {
+            result->neighbour[direction] = neighbour;
+            neighbour->neighbour[OPPOSITE(direction)] = result;
+        }
+    }
+
+    sparse->chunk[sparse->count++] = result;
+
+exit:
+    return result;
+}
+
+static void
+gol_sparse_release(
+    __inout gol_sparse_t *sparse,
+    __in size_t index
+    )
+{
+    gol_sparse_chunk_t **link, *chunk = sparse->chunk[index];
+
+    for(link = &sparse->bucket[gol_sparse_hash(sparse, chunk->x, chunk->y)]; *link != chunk; link = &(*link)->next);
+    *link = chunk->next;
+
+    for(uint32_t direction = NORTH; direction <= NORTH_WEST; ++direction) {
+
+        if(chunk->neighbour[direction]) {
+            chunk->neighbour[direction]->neighbour[OPPOSITE(direction)] = NULL;
+        }
+    }
+
+    sparse->chunk[index] = sparse->chunk[--sparse->count];
+    free(chunk);
+}
+
+static bool
+gol_sparse_border(
+    __in const gol_sparse_t *sparse,
+    __in const gol_sparse_chunk_t *chunk,
+    __in uint32_t direction
+    )
+{
+    uint64_t result = 0;
+    const uint64_t *word = chunk->word[sparse->phase];
+
+    switch(direction) {
+        case NORTH:
+            result = word[0];
+            break;
+        case NORTH_EAST:
+            result = word[0] >> (WORD_BITS - 1);
+            break;
+        case SOUTH_EAST:
+            result = word[SPARSE_ROWS - 1] >> (WORD_BITS - 1);
+            break;
+        case SOUTH:
+            result = word[SPARSE_ROWS - 1];
+            break;
+        case SOUTH_WEST:
+            result = word[SPARSE_ROWS - 1] & 1;
+            break;
+        case NORTH_WEST:
+            result = word[0] & 1;
+            break;
+        default:
+
+            for(uint32_t row = 0; row < SPARSE_ROWS; ++row) {
+                result |= word[row];
+            }
+
+            result = (direction == EAST) ? (result >> (WORD_BITS - 1)) : (result & 1);
+            break;
+    }
+
+    return result != 0;
+}
+
+static int
+gol_sparse_expand(
+    __inout gol_sparse_t *sparse
+    )
+{
+    int result = EXIT_SUCCESS;
+    size_t count = sparse->count;
+
+    for(size_t index = 0; index < count; ++index) {
+        gol_sparse_chunk_t *chunk = sparse->chunk[index];
+
+        for(uint32_t direction = NORTH; direction <= NORTH_WEST; ++direction) {
+
+            if(!chunk->neighbour[direction] && gol_sparse_border(sparse, chunk, direction)
+                    && !gol_sparse_create(sparse, (int64_t)chunk->x + OFFSET[direction][0],
+                        (int64_t)chunk->y + OFFSET[direction][1])) {
+                result = GOL_ERROR(EXIT_FAILURE);
+                goto exit;
+            }
+        }
+    }
+
+exit:
+    return result;
+}
+
+static void
+gol_sparse_collect(
+    __inout gol_sparse_t *sparse
+    )
+{
+
+    for(size_t index = 0; index < sparse->count;) {
+        bool keep = false;
+        gol_sparse_chunk_t *chunk = sparse->chunk[index];
+
+        for(uint32_t direction = NORTH; !keep && (direction <= NORTH_WEST); ++direction) {
+            keep = (chunk->idle < SPARSE_IDLE) || (chunk->neighbour[direction]
+                && gol_sparse_border(sparse, chunk->neighbour[direction], OPPOSITE(direction)));
+        }
+
+        if(keep) {
+            ++index;
+        } else {
+            gol_sparse_release(sparse, index);
+        }
+    }
+
+    if((sparse->capacity > SPARSE_BUCKETS) && (sparse->count < (sparse->capacity / 4))) {
+        gol_sparse_resize(sparse, sparse->capacity / 2);
+    }
+
+    if((sparse->buckets > SPARSE_BUCKETS) && (sparse->count < (sparse->buckets / 4))) {
+        gol_sparse_rehash(sparse, sparse->buckets / 2);
+    }
+}
+
+static void
+gol_sparse_step_chunk(
+    __in const gol_sparse_t *sparse,
+    __inout gol_pool_counter_t *counter,
+    __inout gol_sparse_chunk_t *chunk
+    )
+{
+    uint64_t local[(SPARSE_ROWS + 2) * 3], *next = chunk->word[!sparse->phase], live = 0;
+    const uint64_t *word[8], *center = chunk->word[sparse->phase];
+
+    for(uint32_t direction = NORTH; direction <= NORTH_WEST; ++direction) {
+        word[direction] = chunk->neighbour[direction] ? chunk->neighbour[direction]->word[sparse->phase] : ZERO;
+    }
+
+    local[0] = word[NORTH_WEST][SPARSE_ROWS - 1];
+    local[1] = word[NORTH][SPARSE_ROWS - 1];
+    local[2] = word[NORTH_EAST][SPARSE_ROWS - 1];
+
+    for(uint32_t row = 0; row < SPARSE_ROWS; ++row) {
+        local[(row + 1) * 3] = word[WEST][row];
+        local[((row + 1) * 3) + 1] = center[row];
+        local[((row + 1) * 3) + 2] = word[EAST][row];
+    }
+
+    local[(SPARSE_ROWS + 1) * 3] = word[SOUTH_WEST][0];
+    local[((SPARSE_ROWS + 1) * 3) + 1] = word[SOUTH][0];
+    local[((SPARSE_ROWS + 1) * 3) + 2] = word[SOUTH_EAST][0];
+
+    for(uint32_t index = 0; index < ((SPARSE_ROWS + 2) * 3); ++index) {
+        live |= local[index];
+    }
+
+    if(live) {
+        live = 0;
+
+        for(uint32_t row = 0; row < SPARSE_ROWS; ++row) {
+            sparse->kernel(&local[(row * 3) + 1], &local[((row + 1) * 3) + 1], &local[((row + 2) * 3) + 1], &next[row], 1,
+                &sparse->rule);
+            live |= next[row];
+        }
+    } else {
+        memset(next, 0, SPARSE_ROWS * sizeof(uint64_t));
+    }
+
+    if(sparse->stats) {
+        uint64_t births = 0, deaths = 0;
+
+        sparse->churn(center, next, SPARSE_ROWS, UINT64_MAX, &births, &deaths);
+        counter->births += births;
+        counter->deaths += deaths;
+        counter->tiles += (births || deaths);
+    }
+
+    if(sparse->digest) {
+        counter->digest ^= gol_bits_rehash(center, next, SPARSE_ROWS, UINT64_MAX, CHUNK_POSITION(chunk));
+    }
+
+    chunk->idle = live ? 0 : (chunk->idle + 1);
+}
+
+static void
+gol_sparse_step_band(
+    __in void *context,
+    __in size_t index,
+    __in size_t count
+    )
+{
+    gol_sparse_t *sparse = context;
+    gol_pool_counter_t *counter = &sparse->pool.counter[index];
+    size_t begin = (sparse->count * index) / count, end = (sparse->count * (index + 1)) / count;
+
+    for(size_t chunk = begin; chunk < end; ++chunk) {
+        gol_sparse_step_chunk(sparse, counter, sparse->chunk[chunk]);
+    }
+}
+
+const uint64_t *
+gol_sparse_frame(
+    __inout gol_sparse_t *sparse
+    )
+{
+    memset(sparse->frame, 0, sparse->stride * sparse->height * sizeof(uint64_t));
+
+    for(size_t index = 0; index < sparse->count; ++index) {
+        const gol_sparse_chunk_t *chunk = sparse->chunk[index];
+
+        if((chunk->x >= 0) && ((size_t)chunk->x < sparse->stride)) {
+            uint64_t mask = (((size_t)chunk->x + 1) == sparse->stride) ? sparse->mask : UINT64_MAX;
+
+            for(uint32_t row = 0; row < SPARSE_ROWS; ++row) {
+                int64_t y = ((int64_t)chunk->y * SPARSE_ROWS) + row;
+
+                if((y >= 0) && (y < (int64_t)sparse->height)) {
+                    sparse->frame[(y * sparse->stride) + chunk->x] = chunk->word[sparse->phase][row] & mask;
+                }
+            }
+        }
+    }
+
+    return sparse->frame;
+}
+
+int
+gol_sparse_init(
+    __inout gol_sparse_t *sparse,
+    __in const gol_config_t *config,
+    __inout gol_snapshot_t *snapshot
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    if(!config->width || !config->height) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if((result = gol_rule_parse(&sparse->rule, config->rule ? config->rule : RULE_DEFAULT)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    if((sparse->rule.birth & 1) || (sparse->rule.states > 2)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    sparse->width = config->width;
+    sparse->height = config->height;
+    sparse->stride = (sparse->width + WORD_BITS - 1) / WORD_BITS;
+    sparse->mask = UINT64_MAX >> ((WORD_BITS - 1) - ((sparse->width - 1) & (WORD_BITS - 1)));
+    sparse->kernel = gol_kernel(GOL_KERNEL_SCALAR, &sparse->rule);
+    sparse->churn = gol_bits_churn();
+
+    if(!(sparse->frame = calloc(sparse->stride * sparse->height, sizeof(uint64_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if((result = gol_sparse_resize(sparse, SPARSE_BUCKETS)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    if((result = gol_sparse_rehash(sparse, SPARSE_BUCKETS)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    if(snapshot->word) {
+
+        if((result = gol_snapshot_verify(snapshot, 0, snapshot->height)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+
+        for(size_t y = 0; y < sparse->height; ++y) {
+            memcpy(&sparse->frame[y * sparse->stride], &snapshot->word[y * snapshot->stride],
+                sparse->stride * sizeof(uint64_t));
+        }
+    } else if(config->pattern) {
+
+        if((result = gol_pattern_load(config->pattern, sparse->frame, sparse->stride, sparse->width, sparse->height,
+                config->x, config->y)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+    } else {
+        gol_random_t random;
+
+        gol_random_init(&random, config->seed, config->density);
+        gol_random_fill(&random, sparse->frame, sparse->stride * sparse->height, 0);
+
+        for(size_t y = 0; y < sparse->height; ++y) {
+            sparse->frame[((y + 1) * sparse->stride) - 1] &= sparse->mask;
+        }
+    }
+
+    for(size_t y = 0; y < sparse->height; ++y) {
+
+        for(size_t x = 0; x < sparse->stride; ++x) {
+            gol_sparse_chunk_t *chunk;
+            uint64_t word = sparse->frame[(y * sparse->stride) + x];
+
+            if((x + 1) == sparse->stride) {
+                word &= sparse->mask;
+            }
+
+            if(word) {
+
+                if(!(chunk = gol_sparse_find(sparse, x, y / SPARSE_ROWS))
+                        && !(chunk = gol_sparse_create(sparse, x, y / SPARSE_ROWS))) {
+                    result = GOL_ERROR(EXIT_FAILURE);
+                    goto exit;
+                }
+
+                chunk->word[sparse->phase][y % SPARSE_ROWS] = word;
+            }
+        }
+    }
+
+    if((result = gol_pool_init(&sparse->pool, config->threads)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+exit:
+    return result;
+}
+
+uint64_t
+gol_sparse_digest(
+    __in const gol_sparse_t *sparse
+    )
+{
+    uint64_t result = 0;
+
+    for(size_t index = 0; index < sparse->count; ++index) {
+        const gol_sparse_chunk_t *chunk = sparse->chunk[index];
+
+        result ^= gol_bits_hash(chunk->word[sparse->phase], SPARSE_ROWS, UINT64_MAX, CHUNK_POSITION(chunk));
+    }
+
+    return result;
+}
+
+uint64_t
+gol_sparse_population(
+    __in const gol_sparse_t *sparse
+    )
+{
+    uint64_t result = 0;
+
+    for(size_t index = 0; index < sparse->count; ++index) {
+
+        for(uint32_t row = 0; row < SPARSE_ROWS; ++row) {
+            result += __builtin_popcountll(sparse->chunk[index]->word[sparse->phase][row]);
+        }
+    }
+
+    return result;
+}
+
+int
+gol_sparse_step(
+    __inout gol_sparse_t *sparse
+    )
+{
+    int result;
+
+    if((result = gol_sparse_expand(sparse)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    gol_pool_run(&sparse->pool, gol_sparse_step_band, sparse);
+    sparse->phase = !sparse->phase;
+    gol_sparse_collect(sparse);
+
+exit:
+    return result;
+}
+
+void
+gol_sparse_uninit(
+    __inout gol_sparse_t *sparse
+    )
+{
+    gol_pool_uninit(&sparse->pool);
+
+    for(size_t index = 0; index < sparse->count; ++index) {
+        free(sparse->chunk[index]);
+    }
+
+    if(sparse->chunk) {
+        free(sparse->chunk);
+    }
+
+    if(sparse->bucket) {
+        free(sparse->bucket);
+    }
+
+    if(sparse->frame) {
+        free(sparse->frame);
+    }
+
+    memset(sparse, 0, sizeof(*sparse));
+}
+
+int
+gol_sparse_write(
+    __inout gol_sparse_t *sparse,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t x,
+    __in size_t y,
+    __in size_t width,
+    __in size_t height
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    for(size_t row = 0; row < height; ++row) {
+
+        for(size_t column = x / WORD_BITS; column <= ((x + width - 1) / WORD_BITS); ++column) {
+            gol_sparse_chunk_t *chunk;
+            uint64_t mask = 0, value = 0;
+            size_t begin = (x > (column * WORD_BITS)) ? (x - (column * WORD_BITS)) : 0,
+                end = ((x + width) < ((column + 1) * WORD_BITS)) ? ((x + width) - (column * WORD_BITS)) : WORD_BITS;
+
+            gol_bits_fill(&mask, begin, end - begin, true);
+            gol_bits_copy(&value, begin, &word[row * stride], (column * WORD_BITS) + begin - x, end - begin);
+
+            if(!(chunk = gol_sparse_find(sparse, column, (y + row) / SPARSE_ROWS))) {
+
+                if(!value) {
+                    continue;
+                }
+
+                if(!(chunk = gol_sparse_create(sparse, column, (y + row) / SPARSE_ROWS))) {
+                    result = GOL_ERROR(EXIT_FAILURE);
+                    goto exit;
+                }
+            }
+
+            chunk->word[sparse->phase][(y + row) % SPARSE_ROWS] =
+                (chunk->word[sparse->phase][(y + row) % SPARSE_ROWS] & ~mask) | value;
+            chunk->idle = 0;
+        }
+    }
+
+exit:
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
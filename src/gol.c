@@ -20,186 +20,334 @@
  */
 
 #include <time.h>
-#include "../include/gol.h"
+#include "../include/engine.h"
+#include "../include/log.h"
 #include "../include/service.h"
+#include "../include/snapshot.h"
+#include "../include/stream.h"
 
-#define BIT_MASK(_X_) \
-    (1 << ((_X_) % sizeof(uint8_t)))
+#ifdef SERVICE_NULL
+#define HEADLESS true
+#else
+#define HEADLESS false
+#endif /* SERVICE_NULL */
 
-#define BIT_OFFSET(_GOL_, _X_, _Y_) \
-    (((_Y_) * (_GOL_)->width) / sizeof(uint8_t)) + ((_X_) / sizeof(uint8_t))
+typedef struct {
+    const gol_config_t *config;
+    gol_engine_t *engine;
+    gol_buffer_t *buffer;
+    gol_snapshot_writer_t *writer;
+    gol_log_t *log;
+    gol_stream_t *stream;
+    bool exit;
+    bool done;
+    int result;
+    gol_error_t error;
+} gol_simulation_t;
 
-#define BYTE_OFFSET(_GOL_, _X_, _Y_) \
-    (((_Y_) * ((_GOL_)->width / sizeof(uint8_t))) + (_X_))
+static double
+gol_elapsed(
+    __in const struct timespec *begin
+    )
+{
+    struct timespec end;
 
-#define CELL_CHECK(_GOL_, _X_, _Y_) \
-    ((_GOL_)->previous[BIT_OFFSET(_GOL_, _X_, _Y_)] & BIT_MASK(_X_))
+    clock_gettime(CLOCK_MONOTONIC, &end);
 
-#define CELL_CLEAR(_GOL_, _X_, _Y_) \
-    ((_GOL_)->next[BIT_OFFSET(_GOL_, _X_, _Y_)] &= ~BIT_MASK(_X_))
+    return (end.tv_sec - begin->tv_sec) + ((end.tv_nsec - begin->tv_nsec) / 1e9);
+}
 
-#define CELL_INIT(_GOL_, _X_, _Y_) \
-    ((_GOL_)->previous[BIT_OFFSET(_GOL_, _X_, _Y_)] |= BIT_MASK(_X_))
+static int
+gol_checkpoint(
+    __inout gol_engine_t *engine,
+    __inout gol_snapshot_writer_t *writer,
+    __in const gol_config_t *config,
+    __inout uint64_t *checkpoint
+    )
+{
+    bool lent;
+    size_t stride;
+    const uint64_t *frame;
+    int result = EXIT_SUCCESS;
 
-#define CELL_SET(_GOL_, _X_, _Y_) \
-    ((_GOL_)->next[BIT_OFFSET(_GOL_, _X_, _Y_)] |= BIT_MASK(_X_))
+    if(!config->snapshot || !config->interval || (engine->generation < *checkpoint)) {
+        goto exit;
+    }
 
-typedef struct {
-    size_t width;
-    size_t height;
-    uint8_t *previous;
-    uint8_t *next;
-} gol_t;
+    if(!gol_snapshot_writer_busy(writer)) {
+        gol_engine_release(engine);
 
-typedef struct {
-    int32_t x;
-    int32_t y;
-} gol_coordinate_t;
-
-static const gol_coordinate_t OFFSET[] = {
-    { -1, -1 },
-    {  0, -1 },
-    {  1, -1 },
-    { -1,  0 },
-    {  1,  0 },
-    { -1,  1 },
-    {  0,  1 },
-    {  1,  1 },
-    };
+        if(!(frame = gol_engine_lend(engine, &stride, &lent))) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
 
-static void
+        result = gol_snapshot_writer_post(writer, frame, stride, engine->width, engine->height, &engine->rule,
+            engine->generation, !lent);
+    }
+
+    *checkpoint = engine->generation + config->interval;
+
+exit:
+    return result;
+}
+
+static int
+gol_checkpoint_final(
+    __inout gol_engine_t *engine,
+    __inout gol_snapshot_writer_t *writer,
+    __inout gol_log_t *log,
+    __inout gol_stream_t *stream,
+    __in const gol_config_t *config,
+    __in int result
+    )
+{
+    size_t stride;
+    const uint64_t *frame;
+    int status = gol_snapshot_writer_uninit(writer), logged = gol_log_uninit(log), streamed = gol_stream_uninit(stream);
+
+    if((result != EXIT_SUCCESS) || ((result = status) != EXIT_SUCCESS) || ((result = logged) != EXIT_SUCCESS)
+            || ((result = streamed) != EXIT_SUCCESS) || !config->snapshot) {
+        goto exit;
+    }
+
+    if(!(frame = gol_engine_frame(engine, &stride))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    result = gol_snapshot_save(config->snapshot, frame, stride, engine->width, engine->height, &engine->rule,
+        engine->generation);
+
+exit:
+    return result;
+}
+
+static int
 gol_display(
-    __in const gol_t *gol
+    __in const gol_engine_t *engine,
+    __in const gol_buffer_slot_t *slot
     )
 {
+    return gol_service_frame(slot->word, slot->span, engine->stride, engine->width, engine->height);
+}
 
-    for(uint32_t y = 0; y < (gol->height / sizeof(uint8_t)); ++y) {
+static void
+gol_pace(
+    __in const gol_simulation_t *simulation,
+    __in const struct timespec *begin,
+    __in uint64_t start
+    )
+{
+    double delay;
 
-        for(uint32_t x = 0; x < (gol->width / sizeof(uint8_t)); ++x) {
-            uint8_t row = gol->previous[BYTE_OFFSET(gol, x, y)];
+    while(!__atomic_load_n(&simulation->exit, __ATOMIC_RELAXED)
+            && ((delay = (((simulation->engine->generation - start) / simulation->config->rate) - gol_elapsed(begin))) > 0)) {
+        struct timespec interval = {};
 
-            for(uint8_t idx = 0; idx < sizeof(uint8_t); ++idx) {
-                gol_service_pixel(row & 1, x * sizeof(uint8_t), y * sizeof(uint8_t));
-                row >>= 1;
-            }
+        if(delay > (1.0 / FPS)) {
+            delay = 1.0 / FPS;
         }
+
+        interval.tv_nsec = delay * 1e9;
+        nanosleep(&interval, NULL);
     }
 }
 
 static int
-gol_init(
-    __inout gol_t *gol,
-    __in unsigned width,
-    __in uint32_t height
+gol_publish(
+    __inout gol_simulation_t *simulation
     )
 {
+    size_t stride;
+    const uint64_t *frame;
+    gol_buffer_slot_t *slot;
     int result = EXIT_SUCCESS;
 
-    srand(time(NULL));
-    gol->width = width;
-    gol->height = height;
+    if(simulation->buffer && (slot = gol_buffer_acquire(simulation->buffer))) {
 
-    if(!(gol->previous = calloc((gol->width / sizeof(uint8_t)) * (gol->height / sizeof(uint8_t)), sizeof(uint8_t)))) {
-        result = GOL_ERROR(EXIT_FAILURE);
-        goto exit;
-    }
+        if(!(frame = gol_engine_frame(simulation->engine, &stride))) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
 
-    if(!(gol->next = calloc((gol->width / sizeof(uint8_t)) * (gol->height / sizeof(uint8_t)), sizeof(uint8_t)))) {
-        result = GOL_ERROR(EXIT_FAILURE);
-        goto exit;
+        gol_buffer_write(simulation->buffer, slot, frame);
+        gol_buffer_publish(simulation->buffer, simulation->engine->generation);
     }
 
-    for(uint32_t y = 0; y < gol->height; ++y) {
-
-        for(uint32_t x = 0; x < gol->width; ++x) {
+    if(simulation->config->stream && (simulation->engine->generation >= simulation->stream->due)) {
 
-            if(rand() & 1) {
-                CELL_INIT(gol, x, y);
-            }
+        if(!(frame = gol_engine_frame(simulation->engine, &stride))) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
         }
+
+        result = gol_stream_post(simulation->stream, frame, simulation->engine->generation);
     }
 
 exit:
     return result;
 }
 
-static void
-gol_step(
-    __inout gol_t *gol
+static int
+gol_simulate(
+    __inout gol_simulation_t *simulation
     )
 {
+    int result = EXIT_SUCCESS;
+    uint64_t checkpoint, start;
+    struct timespec begin;
+    const gol_config_t *config = simulation->config;
+    gol_engine_t *engine = simulation->engine;
 
-    for(uint32_t y = 0; y < gol->height; ++y) {
+    if(config->snapshot && config->interval
+            && ((result = gol_snapshot_writer_init(simulation->writer, config->snapshot)) != EXIT_SUCCESS)) {
+        goto exit;
+    }
 
-        for(uint32_t x = 0; x < gol->width; ++x) {
-            uint8_t count = 0;
+    if(config->log && ((result = gol_log_init(simulation->log, config->log, config->binary)) != EXIT_SUCCESS)) {
+        goto exit;
+    }
+
+    if(config->stream && ((result = gol_stream_init(simulation->stream, config->stream, engine->stride, engine->width,
+            engine->height, config->cadence, config->keyframe)) != EXIT_SUCCESS)) {
+        goto exit;
+    }
+
+    start = engine->generation;
+    checkpoint = start + config->interval;
+    clock_gettime(CLOCK_MONOTONIC, &begin);
 
-            for(uint8_t index = 0; index < 8; ++index) {
-                const gol_coordinate_t *offset = &OFFSET[index];
+    if((result = gol_publish(simulation)) != EXIT_SUCCESS) {
+        goto exit;
+    }
 
-                if(CELL_CHECK(gol, (x + offset->x) % gol->width, (y + offset->y) % gol->height)) {
-                    ++count;
-                }
-            }
+    while(!__atomic_load_n(&simulation->exit, __ATOMIC_RELAXED) && !engine->cycle.period
+            && (!config->generations || (engine->generation < config->generations))
+            && ((config->duration <= 0) || (gol_elapsed(&begin) < config->duration))) {
+
+        if(config->generations && ((config->generations - engine->generation) < gol_engine_span(engine))) {
+            result = gol_engine_advance(engine, config->generations - engine->generation);
+        } else {
+            result = gol_engine_step(engine);
+        }
+
+        if(result != EXIT_SUCCESS) {
+            goto exit;
+        }
+
+        if((result = gol_checkpoint(engine, simulation->writer, config, &checkpoint)) != EXIT_SUCCESS) {
+            goto exit;
+        }
 
-            if(CELL_CHECK(gol, x, y)) {
+        if(config->log && ((result = gol_log_post(simulation->log, &engine->record)) != EXIT_SUCCESS)) {
+            goto exit;
+        }
 
-                if((count < 2) || (count > 3)) {
-                    CELL_CLEAR(gol, x, y);
-                } else {
-                    CELL_SET(gol, x, y);
-                }
-            } else {
+        if((result = gol_publish(simulation)) != EXIT_SUCCESS) {
+            goto exit;
+        }
 
-                if(count == 3) {
-                    CELL_SET(gol, x, y);
-                } else {
-                    CELL_CLEAR(gol, x, y);
-                }
-            }
+        if(config->rate > 0) {
+            gol_pace(simulation, &begin, start);
         }
     }
 
-    memcpy(gol->previous, gol->next, (gol->width / sizeof(uint8_t)) * (gol->height / sizeof(uint8_t)));
+exit:
+    simulation->result = result;
+    gol_error_save(&simulation->error);
+    __atomic_store_n(&simulation->done, true, __ATOMIC_RELEASE);
+
+    return result;
 }
 
-static void
-gol_uninit(
-    __inout gol_t *gol
+static void *
+gol_simulation(
+    __in void *argument
     )
 {
+    gol_simulate(argument);
 
-    if(gol->next) {
-        free(gol->next);
-    }
+    return NULL;
+}
 
-    if(gol->previous) {
-        free(gol->previous);
+static int
+gol_headless(
+    __in const gol_config_t *config
+    )
+{
+    int result;
+    gol_engine_t engine = {};
+    gol_log_t log = {};
+    gol_snapshot_writer_t writer = {};
+    gol_stream_t stream = {};
+    gol_simulation_t simulation = { .config = config, .engine = &engine, .writer = &writer, .log = &log,
+        .stream = &stream };
+
+    if((result = gol_engine_init(&engine, config)) != EXIT_SUCCESS) {
+        goto exit;
     }
 
-    memset(gol, 0, sizeof(*gol));
+    result = gol_simulate(&simulation);
+
+exit:
+    result = gol_checkpoint_final(&engine, &writer, &log, &stream, config, result);
+    gol_engine_uninit(&engine);
+
+    return result;
 }
 
 int
 gol(
-    __in unsigned long width,
-    __in unsigned long height
+    __in const gol_config_t *config
     )
 {
     int result;
-    gol_t gol = {};
+    pthread_t thread;
+    bool running = false;
+    gol_buffer_t buffer = {};
+    gol_engine_t engine = {};
+    gol_log_t log = {};
+    gol_snapshot_writer_t writer = {};
+    gol_stream_t stream = {};
+    gol_simulation_t simulation = { .config = config, .engine = &engine, .buffer = &buffer, .writer = &writer,
+        .log = &log, .stream = &stream };
+
+    if(!config) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
 
-    if((result = gol_service_init(width, height)) != EXIT_SUCCESS) {
+    if(HEADLESS || config->headless) {
+        result = gol_headless(config);
         goto exit;
     }
 
-    if((result = gol_init(&gol, width, height)) != EXIT_SUCCESS) {
+    if((result = gol_engine_init(&engine, config)) != EXIT_SUCCESS) {
         goto exit;
     }
 
-    while(gol_service_poll()) {
-        gol_step(&gol);
-        gol_display(&gol);
+    if((result = gol_service_init(engine.width, engine.height)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    if((result = gol_buffer_init(&buffer, engine.stride, engine.height)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    if(pthread_create(&thread, NULL, gol_simulation, &simulation)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    running = true;
+
+    while(gol_service_poll() && !__atomic_load_n(&simulation.done, __ATOMIC_ACQUIRE)) {
+        const gol_buffer_slot_t *slot;
+
+        if((slot = gol_buffer_consume(&buffer)) && ((result = gol_display(&engine, slot)) != EXIT_SUCCESS)) {
+            goto exit;
+        }
 
         if((result = gol_service_show()) != EXIT_SUCCESS) {
             goto exit;
@@ -207,7 +355,22 @@ gol(
     }
 
 exit:
-    gol_uninit(&gol);
+
+    if(running) {
+        __atomic_store_n(&simulation.exit, true, __ATOMIC_RELAXED);
+        pthread_join(thread, NULL);
+
+        if((result == EXIT_SUCCESS) && ((result = simulation.result) != EXIT_SUCCESS)) {
+            gol_error_restore(&simulation.error);
+        }
+    }
+
+    if(engine.width) {
+        result = gol_checkpoint_final(&engine, &writer, &log, &stream, config, result);
+    }
+
+    gol_buffer_uninit(&buffer);
+    gol_engine_uninit(&engine);
     gol_service_uninit();
 
     return result;
@@ -0,0 +1,366 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "../include/engine.h"
+#include "../include/log.h"
+
+struct gol_handle_s {
+    gol_engine_t engine;
+    gol_log_t log;
+    gol_error_t error;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static bool
+gol_handle_region(
+    __in const gol_handle_t *handle,
+    __in unsigned long x,
+    __in unsigned long y,
+    __in unsigned long width,
+    __in unsigned long height,
+    __in const uint64_t *word,
+    __in size_t stride
+    )
+{
+    return word && (x <= handle->engine.width) && (width <= (handle->engine.width - x)) && (y <= handle->engine.height)
+        && (height <= (handle->engine.height - y)) && (stride >= ((width + WORD_BITS - 1) / WORD_BITS));
+}
+
+int
+gol_handle_cycle(
+    __inout gol_handle_t *handle,
+    __out uint64_t *period,
+    __out uint64_t *generation
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    if(!period || !generation || !handle->engine.cycle.limit) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        gol_error_save(&handle->error);
+        goto exit;
+    }
+
+    *period = handle->engine.cycle.period;
+    *generation = handle->engine.cycle.since;
+
+exit:
+    return result;
+}
+
+int
+gol_handle_create(
+    __out gol_handle_t **handle,
+    __in const gol_config_t *config
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    if(!handle || !config) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!(*handle = calloc(1, sizeof(**handle)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(((result = gol_engine_init(&(*handle)->engine, config)) != EXIT_SUCCESS) || (config->log
+            && ((result = gol_log_init(&(*handle)->log, config->log, config->binary)) != EXIT_SUCCESS))) {
+        gol_handle_destroy(*handle);
+        *handle = NULL;
+        goto exit;
+    }
+
+exit:
+    return result;
+}
+
+void
+gol_handle_destroy(
+    __inout gol_handle_t *handle
+    )
+{
+
+    if(handle) {
+        gol_log_uninit(&handle->log);
+        gol_engine_uninit(&handle->engine);
+        free(handle);
+    }
+}
+
+int
+gol_handle_diff(
+    __inout gol_handle_t *handle,
+    __in uint64_t from,
+    __in uint64_t to,
+    __in unsigned long x,
+    __in unsigned long y,
+    __in unsigned long width,
+    __in unsigned long height,
+    __out uint64_t *word,
+    __in size_t stride
+    )
+{
+    size_t frame_stride;
+    const uint64_t *frame;
+    int result;
+
+    if((result = gol_handle_recall(handle, from, x, y, width, height, word, stride)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    if(!width || !height) {
+        goto exit;
+    }
+
+    if(!(frame = gol_engine_recall(&handle->engine, to, &frame_stride))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        gol_error_save(&handle->error);
+        goto exit;
+    }
+
+    for(size_t row = 0; row < height; ++row) {
+
+        for(size_t column = 0; column < width; column += WORD_BITS) {
+            uint64_t value = 0;
+
+            gol_bits_copy(&value, 0, &frame[(y + row) * frame_stride], x + column,
+                ((width - column) < WORD_BITS) ? (width - column) : WORD_BITS);
+            word[(row * stride) + (column / WORD_BITS)] ^= value;
+        }
+    }
+
+exit:
+    return result;
+}
+
+const char *
+gol_handle_error(
+    __in const gol_handle_t *handle
+    )
+{
+    return handle->error.str;
+}
+
+uint64_t
+gol_handle_generation(
+    __in const gol_handle_t *handle
+    )
+{
+    return handle->engine.generation;
+}
+
+int
+gol_handle_get(
+    __inout gol_handle_t *handle,
+    __in unsigned long x,
+    __in unsigned long y,
+    __in unsigned long width,
+    __in unsigned long height,
+    __out uint64_t *word,
+    __in size_t stride
+    )
+{
+    return gol_handle_recall(handle, handle->engine.generation, x, y, width, height, word, stride);
+}
+
+const char *
+gol_handle_memory(
+    __in const gol_handle_t *handle
+    )
+{
+    return gol_memory_name(gol_engine_memory(&handle->engine));
+}
+
+uint64_t
+gol_handle_population(
+    __in const gol_handle_t *handle
+    )
+{
+    return gol_engine_population(&handle->engine);
+}
+
+int
+gol_handle_recall(
+    __inout gol_handle_t *handle,
+    __in uint64_t generation,
+    __in unsigned long x,
+    __in unsigned long y,
+    __in unsigned long width,
+    __in unsigned long height,
+    __out uint64_t *word,
+    __in size_t stride
+    )
+{
+    size_t frame_stride;
+    const uint64_t *frame;
+    int result = EXIT_SUCCESS;
+    size_t words = (width + WORD_BITS - 1) / WORD_BITS;
+
+    if(!gol_handle_region(handle, x, y, width, height, word, stride)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!width || !height) {
+        goto exit;
+    }
+
+    if(!(frame = gol_engine_recall(&handle->engine, generation, &frame_stride))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    for(size_t row = 0; row < height; ++row) {
+        gol_bits_copy(&word[row * stride], 0, &frame[(y + row) * frame_stride], x, width);
+        gol_bits_fill(&word[row * stride], width, (words * WORD_BITS) - width, false);
+    }
+
+exit:
+
+    if(result != EXIT_SUCCESS) {
+        gol_error_save(&handle->error);
+    }
+
+    return result;
+}
+
+int
+gol_handle_rewind(
+    __inout gol_handle_t *handle,
+    __in uint64_t generation
+    )
+{
+    int result;
+
+    if((result = gol_engine_rewind(&handle->engine, generation)) != EXIT_SUCCESS) {
+        gol_error_save(&handle->error);
+    }
+
+    return result;
+}
+
+int
+gol_handle_set(
+    __inout gol_handle_t *handle,
+    __in unsigned long x,
+    __in unsigned long y,
+    __in unsigned long width,
+    __in unsigned long height,
+    __in const uint64_t *word,
+    __in size_t stride
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    if(!gol_handle_region(handle, x, y, width, height, word, stride)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(width && height) {
+        result = gol_engine_write(&handle->engine, word, stride, x, y, width, height);
+    }
+
+exit:
+
+    if(result != EXIT_SUCCESS) {
+        gol_error_save(&handle->error);
+    }
+
+    return result;
+}
+
+int
+gol_handle_stats(
+    __inout gol_handle_t *handle,
+    __out gol_stats_t *stats
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    if(!stats || !handle->engine.stats) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        gol_error_save(&handle->error);
+        goto exit;
+    }
+
+    *stats = handle->engine.record;
+
+exit:
+    return result;
+}
+
+int
+gol_handle_step(
+    __inout gol_handle_t *handle,
+    __in uint64_t generations
+    )
+{
+    int result;
+
+    if((result = gol_engine_advance(&handle->engine, generations)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    if(handle->log.file) {
+        result = gol_log_post(&handle->log, &handle->engine.record);
+    }
+
+exit:
+
+    if(result != EXIT_SUCCESS) {
+        gol_error_save(&handle->error);
+    }
+
+    return result;
+}
+
+int
+gol_handle_window(
+    __inout gol_handle_t *handle,
+    __out uint64_t *oldest,
+    __out uint64_t *newest
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    if(!oldest || !newest) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        gol_error_save(&handle->error);
+        goto exit;
+    }
+
+    *oldest = gol_engine_oldest(&handle->engine);
+    *newest = handle->engine.generation;
+
+exit:
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
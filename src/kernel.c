@@ -0,0 +1,190 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "../include/kernel.h"
+
+#define KERNEL_ENTRY(_KERNEL_, _RULE_, _BIRTH_, _SURVIVAL_) \
+    { _BIRTH_, _SURVIVAL_, _KERNEL_ ## _ ## _RULE_ },
+
+typedef struct {
+    uint32_t birth;
+    uint32_t survival;
+    gol_kernel_t kernel;
+} gol_kernel_rule_t;
+
+static const char *KERNEL_NAME[] = {
+    "scalar",
+    "sse2",
+    "avx2",
+    "avx512",
+    };
+
+static const gol_kernel_rule_t KERNEL_SCALAR[] = {
+    GOL_KERNEL_RULES(KERNEL_ENTRY, gol_kernel_scalar)
+    };
+
+#if defined(__x86_64__) || defined(__i386__)
+static const gol_kernel_rule_t KERNEL_SSE2[] = {
+    GOL_KERNEL_RULES(KERNEL_ENTRY, gol_kernel_sse2)
+    };
+
+static const gol_kernel_rule_t KERNEL_AVX2[] = {
+    GOL_KERNEL_RULES(KERNEL_ENTRY, gol_kernel_avx2)
+    };
+
+static const gol_kernel_rule_t KERNEL_AVX512[] = {
+    GOL_KERNEL_RULES(KERNEL_ENTRY, gol_kernel_avx512)
+    };
+#endif /* __x86_64__ || __i386__ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static gol_kernel_t
+gol_kernel_rule(
+    __in const gol_kernel_rule_t *entry,
+    __in gol_kernel_t generic,
+    __in const gol_rule_t *rule
+    )
+{
+    gol_kernel_t result = generic;
+
+    for(size_t index = 0; index < (sizeof(KERNEL_SCALAR) / sizeof(*KERNEL_SCALAR)); ++index) {
+
+        if((entry[index].birth == rule->birth) && (entry[index].survival == rule->survival)) {
+            result = entry[index].kernel;
+            break;
+        }
+    }
+
+    return result;
+}
+
+gol_kernel_t
+gol_kernel(
+    __in gol_kernel_e type,
+    __in const gol_rule_t *rule
+    )
+{
+    gol_kernel_t result = NULL;
+
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+#endif /* __x86_64__ || __i386__ */
+
+    switch(type) {
+        case GOL_KERNEL_SCALAR:
+            result = gol_kernel_rule(KERNEL_SCALAR, gol_kernel_scalar_generic, rule);
+            break;
+#if defined(__x86_64__) || defined(__i386__)
+        case GOL_KERNEL_SSE2:
+
+            if(__builtin_cpu_supports("sse2")) {
+                result = gol_kernel_rule(KERNEL_SSE2, gol_kernel_sse2_generic, rule);
+            }
+            break;
+        case GOL_KERNEL_AVX2:
+
+            if(__builtin_cpu_supports("avx2")) {
+                result = gol_kernel_rule(KERNEL_AVX2, gol_kernel_avx2_generic, rule);
+            }
+            break;
+        case GOL_KERNEL_AVX512:
+
+            if(__builtin_cpu_supports("avx512f")) {
+                result = gol_kernel_rule(KERNEL_AVX512, gol_kernel_avx512_generic, rule);
+            }
+            break;
+#endif /* __x86_64__ || __i386__ */
+        default:
+            break;
+    }
+
+    return result;
+}
+
+gol_kernel_e
+gol_kernel_best(void)
+{
+    gol_rule_t rule = {};
+    gol_kernel_e result = GOL_KERNEL_MAX - 1;
+
+    while((result > GOL_KERNEL_SCALAR) && !gol_kernel(result, &rule)) {
+        --result;
+    }
+
+    return result;
+}
+
+gol_kernel_ensemble_t
+gol_kernel_ensemble(
+    __in gol_kernel_e type
+    )
+{
+    gol_kernel_ensemble_t result = NULL;
+
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+#endif /* __x86_64__ || __i386__ */
+
+    switch(type) {
+        case GOL_KERNEL_SCALAR:
+            result = gol_kernel_scalar_ensemble;
+            break;
+#if defined(__x86_64__) || defined(__i386__)
+        case GOL_KERNEL_SSE2:
+
+            if(__builtin_cpu_supports("sse2")) {
+                result = gol_kernel_sse2_ensemble;
+            }
+            break;
+        case GOL_KERNEL_AVX2:
+
+            if(__builtin_cpu_supports("avx2")) {
+                result = gol_kernel_avx2_ensemble;
+            }
+            break;
+        case GOL_KERNEL_AVX512:
+
+            if(__builtin_cpu_supports("avx512f")) {
+                result = gol_kernel_avx512_ensemble;
+            }
+            break;
+#endif /* __x86_64__ || __i386__ */
+        default:
+            break;
+    }
+
+    return result;
+}
+
+const char *
+gol_kernel_name(
+    __in gol_kernel_e type
+    )
+{
+    return (type < GOL_KERNEL_MAX) ? KERNEL_NAME[type] : "unknown";
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
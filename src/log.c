@@ -0,0 +1,219 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <inttypes.h>
+#include "../include/log.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static int
+gol_log_save(
+    __in const gol_log_t *log,
+    __in const gol_stats_t *record,
+    __in size_t count
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    if(log->binary) {
+
+        if(fwrite(record, sizeof(*record), count, log->file) != count) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+    } else {
+
+        for(size_t index = 0; index < count; ++index) {
+
+            if(fprintf(log->file, "%" PRIu64 ",%" PRIu64 ",%.9f,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64
+                    ",%" PRIu64 "\n", record[index].generation, record[index].generations, record[index].time,
+                    record[index].population, record[index].births, record[index].deaths, record[index].tiles,
+                    record[index].period) < 0) {
+                result = GOL_ERROR(EXIT_FAILURE);
+                goto exit;
+            }
+        }
+    }
+
+exit:
+    return result;
+}
+
+static void *
+gol_log_writer(
+    __in void *argument
+    )
+{
+    gol_log_t *log = argument;
+
+    pthread_mutex_lock(&log->lock);
+
+    for(;;) {
+        int result;
+        size_t count = 0;
+        gol_stats_t record[LOG_BATCH];
+
+        while(!log->exit && (log->head == log->tail)) {
+            pthread_cond_wait(&log->ready, &log->lock);
+        }
+
+        if(log->head == log->tail) {
+            break;
+        }
+
+        result = log->result;
+
+        for(; (count < LOG_BATCH) && (log->tail != log->head); ++count, ++log->tail) {
+            record[count] = log->record[log->tail % LOG_RECORDS];
+        }
+
+        pthread_mutex_unlock(&log->lock);
+
+        if(result == EXIT_SUCCESS) {
+            result = gol_log_save(log, record, count);
+        }
+
+        pthread_mutex_lock(&log->lock);
+
+        if((result != EXIT_SUCCESS) && (log->result == EXIT_SUCCESS)) {
+            log->result = result;
+            gol_error_save(&log->error);
+        }
+    }
+
+    pthread_mutex_unlock(&log->lock);
+
+    return NULL;
+}
+
+int
+gol_log_init(
+    __inout gol_log_t *log,
+    __in const char *path,
+    __in bool binary
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    memset(log, 0, sizeof(*log));
+    log->binary = binary;
+
+    if(!(log->file = fopen(path, binary ? "wb" : "w"))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!binary && (fprintf(log->file, "generation,generations,time,population,births,deaths,tiles,period\n") < 0)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!(log->record = calloc(LOG_RECORDS, sizeof(gol_stats_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(pthread_mutex_init(&log->lock, NULL) || pthread_cond_init(&log->ready, NULL)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!(log->thread = calloc(1, sizeof(pthread_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(pthread_create(log->thread, NULL, gol_log_writer, log)) {
+        free(log->thread);
+        log->thread = NULL;
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+exit:
+    return result;
+}
+
+int
+gol_log_post(
+    __inout gol_log_t *log,
+    __in const gol_stats_t *record
+    )
+{
+    int result;
+
+    pthread_mutex_lock(&log->lock);
+
+    if((result = log->result) != EXIT_SUCCESS) {
+        gol_error_restore(&log->error);
+        goto exit;
+    }
+
+    if((log->head - log->tail) < LOG_RECORDS) {
+        log->record[log->head++ % LOG_RECORDS] = *record;
+        pthread_cond_signal(&log->ready);
+    }
+
+exit:
+    pthread_mutex_unlock(&log->lock);
+
+    return result;
+}
+
+int
+gol_log_uninit(
+    __inout gol_log_t *log
+    )
+{
+    int result = log->result;
+
+    if(log->thread) {
+        pthread_mutex_lock(&log->lock);
+        log->exit = true;
+        pthread_cond_signal(&log->ready);
+        pthread_mutex_unlock(&log->lock);
+        pthread_join(*log->thread, NULL);
+        result = log->result;
+        free(log->thread);
+        pthread_cond_destroy(&log->ready);
+        pthread_mutex_destroy(&log->lock);
+    }
+
+    if(log->file && fclose(log->file) && (result == EXIT_SUCCESS)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+    } else if(result != EXIT_SUCCESS) {
+        gol_error_restore(&log->error);
+    }
+
+    if(log->record) {
+        free(log->record);
+    }
+
+    memset(log, 0, sizeof(*log));
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
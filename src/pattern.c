@@ -0,0 +1,406 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "../include/pattern.h"
+
+#define NUMBER_MAX INT32_MAX
+
+#define LIFE_106 "#Life 1.06"
+
+typedef struct {
+    const char *cursor;
+    const char *end;
+    uint64_t *word;
+    size_t stride;
+    size_t width;
+    size_t height;
+    int64_t x;
+    int64_t y;
+} gol_pattern_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static bool
+gol_pattern_digit(
+    __in char value
+    )
+{
+    return (value >= '0') && (value <= '9');
+}
+
+static bool
+gol_pattern_space(
+    __in char value
+    )
+{
+    return (value == ' ') || (value == '\t') || (value == '\r') || (value == '\n');
+}
+
+static bool
+gol_pattern_letter(
+    __in char value
+    )
+{
+    return ((value >= 'A') && (value <= 'Z')) || ((value >= 'a') && (value <= 'z'));
+}
+
+static void
+gol_pattern_line(
+    __inout gol_pattern_t *pattern
+    )
+{
+    const char *line = memchr(pattern->cursor, '\n', pattern->end - pattern->cursor);
+
+    pattern->cursor = line ? (line + 1) : pattern->end;
+}
+
+static void
+gol_pattern_skip(
+    __inout gol_pattern_t *pattern
+    )
+{
+
+    while((pattern->cursor < pattern->end) && gol_pattern_space(*pattern->cursor)) {
+        ++pattern->cursor;
+    }
+}
+
+static int
+gol_pattern_number(
+    __inout gol_pattern_t *pattern,
+    __out int64_t *value
+    )
+{
+    bool negative = false;
+    int result = EXIT_SUCCESS;
+
+    if((pattern->cursor < pattern->end) && ((*pattern->cursor == '-') || (*pattern->cursor == '+'))) {
+        negative = (*pattern->cursor++ == '-');
+    }
+
+    if((pattern->cursor == pattern->end) || !gol_pattern_digit(*pattern->cursor)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    for(*value = 0; (pattern->cursor < pattern->end) && gol_pattern_digit(*pattern->cursor); ++pattern->cursor) {
+
+        if((*value = (*value * 10) + (*pattern->cursor - '0')) > NUMBER_MAX) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+    }
+
+    if(negative) {
+        *value = -*value;
+    }
+
+exit:
+    return result;
+}
+
+static void
+gol_pattern_set(
+    __inout gol_pattern_t *pattern,
+    __in int64_t x,
+    __in int64_t y,
+    __in int64_t count
+    )
+{
+    uint64_t *row;
+    int64_t begin = pattern->x + x, end = begin + count;
+
+    if(((y += pattern->y) < 0) || (y >= (int64_t)pattern->height)) {
+        return;
+    }
+
+    if(begin < 0) {
+        begin = 0;
+    }
+
+    if(end > (int64_t)pattern->width) {
+        end = pattern->width;
+    }
+
+    row = &pattern->word[y * pattern->stride];
+
+    while(begin < end) {
+        uint32_t shift = begin & (WORD_BITS - 1);
+
+        if((end - begin) < (WORD_BITS - shift)) {
+            row[begin / WORD_BITS] |= ((UINT64_C(1) << (end - begin)) - 1) << shift;
+        } else {
+            row[begin / WORD_BITS] |= UINT64_MAX << shift;
+        }
+
+        begin += WORD_BITS - shift;
+    }
+}
+
+static int
+gol_pattern_life_106(
+    __inout gol_pattern_t *pattern
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    gol_pattern_line(pattern);
+
+    for(;;) {
+        int64_t x, y;
+
+        gol_pattern_skip(pattern);
+
+        if(pattern->cursor == pattern->end) {
+            break;
+        }
+
+        if(*pattern->cursor == '#') {
+            gol_pattern_line(pattern);
+            continue;
+        }
+
+        if((result = gol_pattern_number(pattern, &x)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+
+        while((pattern->cursor < pattern->end) && ((*pattern->cursor == ' ') || (*pattern->cursor == '\t'))) {
+            ++pattern->cursor;
+        }
+
+        if((result = gol_pattern_number(pattern, &y)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+
+        gol_pattern_set(pattern, x, y, 1);
+    }
+
+exit:
+    return result;
+}
+
+static int
+gol_pattern_plaintext(
+    __inout gol_pattern_t *pattern
+    )
+{
+    int64_t y = 0;
+    int result = EXIT_SUCCESS;
+
+    while(pattern->cursor < pattern->end) {
+        int64_t x = 0;
+
+        if(*pattern->cursor == '!') {
+            gol_pattern_line(pattern);
+            continue;
+        }
+
+        while((pattern->cursor < pattern->end) && (*pattern->cursor != '\n')) {
+            const char *begin = pattern->cursor;
+
+            switch(*pattern->cursor) {
+                case '*':
+                case 'O':
+
+                    while((pattern->cursor < pattern->end) && ((*pattern->cursor == 'O') || (*pattern->cursor == '*'))) {
+                        ++pattern->cursor;
+                    }
+
+                    gol_pattern_set(pattern, x, y, pattern->cursor - begin);
+                    x += pattern->cursor - begin;
+                    break;
+                case '.':
+                    ++pattern->cursor;
+                    ++x;
+                    break;
+                case ' ':
+                case '\t':
+                case '\r':
+                    ++pattern->cursor;
+                    break;
+                default:
+                    result = GOL_ERROR(EXIT_FAILURE);
+                    goto exit;
+            }
+        }
+
+        gol_pattern_line(pattern);
+        ++y;
+    }
+
+exit:
+    return result;
+}
+
+static bool
+gol_pattern_rle_header(
+    __inout gol_pattern_t *pattern
+    )
+{
+
+    for(;;) {
+        gol_pattern_skip(pattern);
+
+        if((pattern->cursor == pattern->end) || (*pattern->cursor != '#')) {
+            break;
+        }
+
+        gol_pattern_line(pattern);
+    }
+
+    return (pattern->cursor < pattern->end) && (*pattern->cursor == 'x');
+}
+
+static int
+gol_pattern_rle(
+    __inout gol_pattern_t *pattern
+    )
+{
+    int64_t x = 0, y = 0;
+    int result = EXIT_SUCCESS;
+    const char *cursor, *end = pattern->end;
+
+    gol_pattern_line(pattern);
+
+    for(cursor = pattern->cursor; cursor < end;) {
+        int64_t count = 1;
+        char value = *cursor++;
+
+        if(gol_pattern_digit(value)) {
+
+            for(count = value - '0'; (cursor < end) && gol_pattern_digit(*cursor); ++cursor) {
+
+                if((count = (count * 10) + (*cursor - '0')) > NUMBER_MAX) {
+                    result = GOL_ERROR(EXIT_FAILURE);
+                    goto exit;
+                }
+            }
+
+            if(cursor == end) {
+                result = GOL_ERROR(EXIT_FAILURE);
+                goto exit;
+            }
+
+            value = *cursor++;
+        }
+
+        switch(value) {
+            case '\t':
+            case '\n':
+            case '\r':
+            case ' ':
+                break;
+            case '!':
+                goto exit;
+            case '$':
+                y += count;
+                x = 0;
+                break;
+            case '.':
+            case 'b':
+                x += count;
+                break;
+            default:
+
+                if(!gol_pattern_letter(value)) {
+                    result = GOL_ERROR(EXIT_FAILURE);
+                    goto exit;
+                }
+
+                gol_pattern_set(pattern, x, y, count);
+                x += count;
+                break;
+        }
+    }
+
+exit:
+    pattern->cursor = cursor;
+
+    return result;
+}
+
+int
+gol_pattern_load(
+    __in const char *path,
+    __inout uint64_t *word,
+    __in size_t stride,
+    __in size_t width,
+    __in size_t height,
+    __in int64_t x,
+    __in int64_t y
+    )
+{
+    int file;
+    struct stat status;
+    void *data = MAP_FAILED;
+    int result = EXIT_SUCCESS;
+    gol_pattern_t pattern = { .word = word, .stride = stride, .width = width, .height = height, .x = x, .y = y };
+
+    if((file = open(path, O_RDONLY)) < 0) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(fstat(file, &status) || !status.st_size) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if((data = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, file, 0)) == MAP_FAILED) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    madvise(data, status.st_size, MADV_SEQUENTIAL);
+    pattern.cursor = data;
+    pattern.end = pattern.cursor + status.st_size;
+
+    if((status.st_size >= strlen(LIFE_106)) && !strncmp(pattern.cursor, LIFE_106, strlen(LIFE_106))) {
+        result = gol_pattern_life_106(&pattern);
+    } else if(gol_pattern_rle_header(&pattern)) {
+        result = gol_pattern_rle(&pattern);
+    } else {
+        pattern.cursor = data;
+        result = gol_pattern_plaintext(&pattern);
+    }
+
+exit:
+
+    if(data != MAP_FAILED) {
+        munmap(data, status.st_size);
+    }
+
+    if(file >= 0) {
+        close(file);
+    }
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
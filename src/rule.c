@@ -0,0 +1,143 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <ctype.h>
+#include "../include/rule.h"
+
+#define FIELD_MAX 3
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void
+gol_rule_name(
+    __in const gol_rule_t *rule,
+    __out char *name,
+    __in size_t length
+    )
+{
+    size_t offset = 0;
+    const uint32_t set[] = { rule->birth, rule->survival };
+
+    for(uint32_t field = 0; field < 2; ++field) {
+        offset += snprintf(&name[offset], (offset < length) ? (length - offset) : 0, "%s", field ? "/S" : "B");
+
+        for(uint32_t count = 0; count <= 8; ++count) {
+
+            if(set[field] & (1 << count)) {
+                offset += snprintf(&name[offset], (offset < length) ? (length - offset) : 0, "%u", count);
+            }
+        }
+    }
+
+    if(rule->states > 2) {
+        snprintf(&name[offset], (offset < length) ? (length - offset) : 0, "/%u", rule->states);
+    }
+}
+
+int
+gol_rule_parse(
+    __out gol_rule_t *rule,
+    __in const char *name
+    )
+{
+    int result = EXIT_SUCCESS;
+    uint32_t count = 0, value[FIELD_MAX] = {};
+    char letter[FIELD_MAX] = {};
+
+    memset(rule, 0, sizeof(*rule));
+
+    for(;;) {
+
+        if(isalpha(*name)) {
+            letter[count] = toupper(*name++);
+        }
+
+        if(count < 2) {
+
+            for(; (*name >= '0') && (*name <= '8'); ++name) {
+                value[count] |= 1 << (*name - '0');
+            }
+        } else {
+
+            for(; isdigit(*name) && (value[count] <= RULE_STATES_MAX); ++name) {
+                value[count] = (value[count] * 10) + (*name - '0');
+            }
+        }
+
+        ++count;
+
+        if((*name != '/') || (count == FIELD_MAX)) {
+            break;
+        }
+
+        ++name;
+    }
+
+    if(*name || (count < 2)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!letter[0] && !letter[1]) {
+        rule->survival = value[0];
+        rule->birth = value[1];
+    } else if((letter[0] == 'B') && (letter[1] == 'S')) {
+        rule->birth = value[0];
+        rule->survival = value[1];
+    } else if((letter[0] == 'S') && (letter[1] == 'B')) {
+        rule->survival = value[0];
+        rule->birth = value[1];
+    } else {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    rule->states = (count == FIELD_MAX) ? value[2] : 2;
+
+    if(((count == FIELD_MAX) && letter[2] && (letter[2] != 'C') && (letter[2] != 'G'))
+            || (rule->states < 2) || (rule->states > RULE_STATES_MAX)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+exit:
+    return result;
+}
+
+size_t
+gol_rule_planes(
+    __in const gol_rule_t *rule
+    )
+{
+    size_t result = 1;
+
+    for(uint32_t age = rule->states - 2; age; age >>= 1) {
+        ++result;
+    }
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
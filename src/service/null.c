@@ -0,0 +1,85 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "../../include/service.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+int
+gol_service_clear(void)
+{
+    return EXIT_SUCCESS;
+}
+
+int
+gol_service_frame(
+    __in const uint64_t *word,
+    __in const gol_buffer_span_t *span,
+    __in size_t stride,
+    __in uint32_t width,
+    __in uint32_t height
+    )
+{
+    return EXIT_SUCCESS;
+}
+
+int
+gol_service_init(
+    __in uint32_t width,
+    __in uint32_t height
+    )
+{
+    return EXIT_SUCCESS;
+}
+
+void
+gol_service_pixel(
+    __in bool alive,
+    __in uint32_t x,
+    __in uint32_t y
+    )
+{
+    return;
+}
+
+bool
+gol_service_poll(void)
+{
+    return true;
+}
+
+int
+gol_service_show(void)
+{
+    return EXIT_SUCCESS;
+}
+
+void
+gol_service_uninit(void)
+{
+    return;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -22,12 +22,31 @@
 #include <SDL2/SDL.h>
 #include "../../include/service.h"
 
+#define VIEW_HEIGHT 720
+#define VIEW_WIDTH 1280
+
+#define ZOOM_MAX 5
+
+typedef uint32_t gol_sdl_pixel_t __attribute__((vector_size(4 * sizeof(uint32_t)), aligned(sizeof(uint32_t)), __may_alias__));
+
 typedef struct {
     uint32_t tick;
     bool fullscreen;
+    bool dirty;
+    bool stale;
+    bool moved;
     size_t width;
     size_t height;
+    size_t view_width;
+    size_t view_height;
+    int32_t zoom;
+    int64_t x;
+    int64_t y;
+    int32_t drag[2];
+    size_t stride;
+    const uint64_t *word;
     uint32_t *pixel;
+    gol_mipmap_t mipmap;
     SDL_Renderer *renderer;
     SDL_Texture *texture;
     SDL_Window *window;
@@ -39,6 +58,226 @@ static gol_sdl_t g_service = {};
 extern "C" {
 #endif /* __cplusplus */
 
+static int64_t
+gol_service_cells(
+    __in size_t pixels
+    )
+{
+    return (g_service.zoom < 0) ? ((int64_t)pixels << -g_service.zoom)
+        : (((int64_t)pixels + (1 << g_service.zoom) - 1) >> g_service.zoom);
+}
+
+static void
+gol_service_clamp(void)
+{
+    int64_t limit[2] = { g_service.width - gol_service_cells(g_service.view_width),
+        g_service.height - gol_service_cells(g_service.view_height) };
+    int64_t *origin[2] = { &g_service.x, &g_service.y };
+
+    for(uint32_t axis = 0; axis < 2; ++axis) {
+
+        if(*origin[axis] > limit[axis]) {
+            *origin[axis] = limit[axis];
+        }
+
+        if(*origin[axis] < 0) {
+            *origin[axis] = 0;
+        }
+
+        if(g_service.zoom < 0) {
+            *origin[axis] &= ~((1LL << -g_service.zoom) - 1);
+        }
+    }
+
+    g_service.moved = true;
+}
+
+static void
+gol_service_expand(
+    __in const uint64_t *word,
+    __in size_t offset,
+    __inout uint32_t *pixel,
+    __in uint32_t width
+    )
+{
+    uint32_t x = 0;
+    const gol_sdl_pixel_t bit = { 1, 2, 4, 8 }, dead = { DEAD, DEAD, DEAD, DEAD },
+        toggle = { ALIVE ^ DEAD, ALIVE ^ DEAD, ALIVE ^ DEAD, ALIVE ^ DEAD };
+
+    for(; (x + WORD_BITS) <= width; x += WORD_BITS) {
+        size_t cell = offset + x;
+        uint64_t value = word[cell / WORD_BITS] >> (cell & (WORD_BITS - 1));
+
+        if(cell & (WORD_BITS - 1)) {
+            value |= word[(cell / WORD_BITS) + 1] << (WORD_BITS - (cell & (WORD_BITS - 1)));
+        }
+
+        for(uint32_t index = 0; index < WORD_BITS; index += 4) {
+            uint32_t nibble = value & 15;
+            gol_sdl_pixel_t mask = (gol_sdl_pixel_t)(((gol_sdl_pixel_t){ nibble, nibble, nibble, nibble } & bit) != 0);
+
+            *(gol_sdl_pixel_t *)&pixel[x + index] = dead ^ (mask & toggle);
+            value >>= 4;
+        }
+    }
+
+    for(; x < width; ++x) {
+        size_t cell = offset + x;
+
+        pixel[x] = ((word[cell / WORD_BITS] >> (cell & (WORD_BITS - 1))) & 1) ? ALIVE : DEAD;
+    }
+}
+
+static uint32_t
+gol_service_shade(
+    __in uint8_t density
+    )
+{
+    uint32_t result = 0;
+
+    for(uint32_t channel = 0; channel < 32; channel += 8) {
+        int32_t alive = (ALIVE >> channel) & 0xFF, dead = (DEAD >> channel) & 0xFF;
+
+        result |= (uint32_t)(dead + ((((alive - dead) * density) + 127) / 255)) << channel;
+    }
+
+    return result;
+}
+
+static void
+gol_service_row(
+    __inout uint32_t *pixel,
+    __in int64_t x,
+    __in int64_t y,
+    __in uint32_t width
+    )
+{
+    uint32_t index = 0;
+
+    if(g_service.zoom < 0) {
+        uint32_t level = -g_service.zoom;
+
+        for(; index < width; ++index) {
+            pixel[index] = gol_service_shade(gol_mipmap_density(&g_service.mipmap, g_service.word, g_service.stride, level,
+                (g_service.x >> level) + x + index, (g_service.y >> level) + y));
+        }
+    } else if(g_service.zoom > 0) {
+        y = g_service.y + (y >> g_service.zoom);
+
+        for(; (y < g_service.height) && (index < width); ++index) {
+            int64_t cell = g_service.x + ((x + index) >> g_service.zoom);
+
+            if(cell >= g_service.width) {
+                break;
+            }
+
+            pixel[index] = ((g_service.word[(y * g_service.stride) + (cell / WORD_BITS)] >> (cell & (WORD_BITS - 1))) & 1)
+                ? ALIVE : DEAD;
+        }
+    } else if(((g_service.y + y) < g_service.height) && ((g_service.x + x) < g_service.width)) {
+        index = g_service.width - (g_service.x + x);
+
+        if(index > width) {
+            index = width;
+        }
+
+        gol_service_expand(&g_service.word[(g_service.y + y) * g_service.stride], g_service.x + x, pixel, index);
+    }
+
+    for(; index < width; ++index) {
+        pixel[index] = DEAD;
+    }
+}
+
+static int
+gol_service_draw(
+    __in const SDL_Rect *rect
+    )
+{
+    int pitch;
+    void *pixel;
+    int result = EXIT_SUCCESS;
+
+    if(SDL_LockTexture(g_service.texture, rect, &pixel, &pitch)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    for(int y = 0; y < rect->h; ++y) {
+        gol_service_row((uint32_t *)((uint8_t *)pixel + (y * pitch)), rect->x, rect->y + y, rect->w);
+    }
+
+    SDL_UnlockTexture(g_service.texture);
+    g_service.stale = true;
+
+exit:
+    return result;
+}
+
+static int
+gol_service_refresh(void)
+{
+    int result = EXIT_SUCCESS;
+    SDL_Rect rect = { .w = g_service.view_width, .h = g_service.view_height };
+
+    if(g_service.moved && g_service.word) {
+
+        if((result = gol_service_draw(&rect)) != EXIT_SUCCESS) {
+            goto exit;
+        }
+
+        g_service.moved = false;
+    }
+
+exit:
+    return result;
+}
+
+static bool
+gol_service_project(
+    __in size_t x,
+    __in size_t y,
+    __in size_t width,
+    __in size_t height,
+    __out SDL_Rect *rect
+    )
+{
+    int64_t begin[2], end[2];
+    const int64_t bound[2] = { g_service.view_width, g_service.view_height };
+
+    if(g_service.zoom < 0) {
+        uint32_t level = -g_service.zoom;
+
+        begin[0] = (x >> level) - (g_service.x >> level);
+        begin[1] = (y >> level) - (g_service.y >> level);
+        end[0] = ((x + width + (1ULL << level) - 1) >> level) - (g_service.x >> level);
+        end[1] = ((y + height + (1ULL << level) - 1) >> level) - (g_service.y >> level);
+    } else {
+        begin[0] = ((int64_t)x - g_service.x) * (1 << g_service.zoom);
+        begin[1] = ((int64_t)y - g_service.y) * (1 << g_service.zoom);
+        end[0] = ((int64_t)(x + width) - g_service.x) * (1 << g_service.zoom);
+        end[1] = ((int64_t)(y + height) - g_service.y) * (1 << g_service.zoom);
+    }
+
+    for(uint32_t axis = 0; axis < 2; ++axis) {
+
+        if(begin[axis] < 0) {
+            begin[axis] = 0;
+        }
+
+        if(end[axis] > bound[axis]) {
+            end[axis] = bound[axis];
+        }
+    }
+
+    rect->x = begin[0];
+    rect->y = begin[1];
+    rect->w = end[0] - begin[0];
+    rect->h = end[1] - begin[1];
+
+    return (rect->w > 0) && (rect->h > 0);
+}
+
 static int
 gol_service_fullscreen(void)
 {
@@ -60,16 +299,56 @@ exit:
     return result;
 }
 
+static void
+gol_service_fit(void)
+{
+    g_service.zoom = 0;
+    g_service.x = 0;
+    g_service.y = 0;
+
+    while((-g_service.zoom < g_service.mipmap.top)
+            && ((gol_service_cells(g_service.view_width) < g_service.width)
+                || (gol_service_cells(g_service.view_height) < g_service.height))) {
+        --g_service.zoom;
+    }
+
+    gol_service_clamp();
+}
+
+static void
+gol_service_pan(
+    __in int64_t x,
+    __in int64_t y
+    )
+{
+    g_service.x += x;
+    g_service.y += y;
+    gol_service_clamp();
+}
+
 static int
 gol_service_present(void)
 {
     int result = EXIT_SUCCESS;
 
-    if(SDL_UpdateTexture(g_service.texture, NULL, g_service.pixel, g_service.width * sizeof(uint32_t))) {
-        result = GOL_ERROR(EXIT_FAILURE);
+    if((result = gol_service_refresh()) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    if(!g_service.dirty && !g_service.stale) {
         goto exit;
     }
 
+    if(g_service.dirty) {
+
+        if(SDL_UpdateTexture(g_service.texture, NULL, g_service.pixel, g_service.view_width * sizeof(uint32_t))) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+
+        g_service.dirty = false;
+    }
+
     if(SDL_RenderClear(g_service.renderer)) {
         result = GOL_ERROR(EXIT_FAILURE);
         goto exit;
@@ -81,18 +360,41 @@ gol_service_present(void)
     }
 
     SDL_RenderPresent(g_service.renderer);
+    g_service.stale = false;
 
 exit:
     return result;
 }
 
+static void
+gol_service_zoom(
+    __in int32_t zoom
+    )
+{
+    int64_t x = g_service.x + (gol_service_cells(g_service.view_width) / 2),
+        y = g_service.y + (gol_service_cells(g_service.view_height) / 2);
+
+    zoom += g_service.zoom;
+
+    if(zoom > ZOOM_MAX) {
+        zoom = ZOOM_MAX;
+    } else if(zoom < -(int32_t)g_service.mipmap.top) {
+        zoom = -(int32_t)g_service.mipmap.top;
+    }
+
+    g_service.zoom = zoom;
+    g_service.x = x - (gol_service_cells(g_service.view_width) / 2);
+    g_service.y = y - (gol_service_cells(g_service.view_height) / 2);
+    gol_service_clamp();
+}
+
 int
 gol_service_clear(void)
 {
 
-    for(int y = 0; y < g_service.height; ++y) {
+    for(int y = 0; y < g_service.view_height; ++y) {
 
-        for(int x = 0; x < g_service.width; ++x) {
+        for(int x = 0; x < g_service.view_width; ++x) {
             gol_service_pixel(false, x, y);
         }
     }
@@ -100,6 +402,69 @@ gol_service_clear(void)
     return gol_service_present();
 }
 
+int
+gol_service_frame(
+    __in const uint64_t *word,
+    __in const gol_buffer_span_t *span,
+    __in size_t stride,
+    __in uint32_t width,
+    __in uint32_t height
+    )
+{
+    SDL_Rect pending = {};
+    int result = EXIT_SUCCESS;
+
+    g_service.word = word;
+    g_service.stride = stride;
+
+    if(width > g_service.width) {
+        width = g_service.width;
+    }
+
+    if(height > g_service.height) {
+        height = g_service.height;
+    }
+
+    for(uint32_t band = 0; (band * BUFFER_BAND) < height; ++band) {
+        SDL_Rect rect;
+        size_t x = span[band].begin * WORD_BITS, y = band * BUFFER_BAND;
+
+        if((span[band].begin >= span[band].end) || (x >= width)) {
+            continue;
+        }
+
+        gol_mipmap_update(&g_service.mipmap, word, stride, x, y, (span[band].end * WORD_BITS) - x, BUFFER_BAND);
+
+        if(g_service.moved || !gol_service_project(x, y, (span[band].end * WORD_BITS) - x, BUFFER_BAND, &rect)) {
+            continue;
+        }
+
+        if(pending.h && (rect.y < (pending.y + pending.h))) {
+            int right = ((pending.x + pending.w) > (rect.x + rect.w)) ? (pending.x + pending.w) : (rect.x + rect.w);
+
+            pending.x = (pending.x < rect.x) ? pending.x : rect.x;
+            pending.w = right - pending.x;
+            pending.h = ((rect.y + rect.h) > (pending.y + pending.h)) ? ((rect.y + rect.h) - pending.y) : pending.h;
+            continue;
+        }
+
+        if(pending.h && ((result = gol_service_draw(&pending)) != EXIT_SUCCESS)) {
+            goto exit;
+        }
+
+        pending = rect;
+    }
+
+    if(pending.h && ((result = gol_service_draw(&pending)) != EXIT_SUCCESS)) {
+        goto exit;
+    }
+
+    result = gol_service_refresh();
+
+exit:
+    return result;
+}
+
 int
 gol_service_init(
     __in uint32_t width,
@@ -110,19 +475,27 @@ gol_service_init(
 
     g_service.width = width;
     g_service.height = height;
+    g_service.view_width = (width < VIEW_WIDTH) ? width : VIEW_WIDTH;
+    g_service.view_height = (height < VIEW_HEIGHT) ? height : VIEW_HEIGHT;
 
-    if(!(g_service.pixel = calloc(g_service.width * g_service.height, sizeof(uint32_t)))) {
+    if(!(g_service.pixel = calloc(g_service.view_width * g_service.view_height, sizeof(uint32_t)))) {
         result = GOL_ERROR(EXIT_FAILURE);
         goto exit;
     }
 
+    if((result = gol_mipmap_init(&g_service.mipmap, width, height)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    gol_service_fit();
+
     if(SDL_Init(SDL_INIT_VIDEO)) {
         result = GOL_ERROR(EXIT_FAILURE);
         goto exit;
     }
 
     if(!(g_service.window = SDL_CreateWindow("Game of Life", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
-            g_service.width * SCALE, g_service.height * SCALE, SDL_WINDOW_RESIZABLE))) {
+            g_service.view_width * SCALE, g_service.view_height * SCALE, SDL_WINDOW_RESIZABLE))) {
         result = GOL_ERROR(EXIT_FAILURE);
         goto exit;
     }
@@ -132,7 +505,7 @@ gol_service_init(
         goto exit;
     }
 
-    if(SDL_RenderSetLogicalSize(g_service.renderer, g_service.width, g_service.height)) {
+    if(SDL_RenderSetLogicalSize(g_service.renderer, g_service.view_width, g_service.view_height)) {
         result = GOL_ERROR(EXIT_FAILURE);
         goto exit;
     }
@@ -148,7 +521,7 @@ gol_service_init(
     }
 
     if(!(g_service.texture = SDL_CreateTexture(g_service.renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
-            g_service.width, g_service.height))) {
+            g_service.view_width, g_service.view_height))) {
         result = GOL_ERROR(EXIT_FAILURE);
         goto exit;
     }
@@ -166,7 +539,11 @@ gol_service_pixel(
     __in uint32_t y
     )
 {
-    g_service.pixel[(y * g_service.width) + x] = alive ? ALIVE : DEAD;
+
+    if((x < g_service.view_width) && (y < g_service.view_height)) {
+        g_service.pixel[(y * g_service.view_width) + x] = alive ? ALIVE : DEAD;
+        g_service.dirty = true;
+    }
 }
 
 bool
@@ -178,6 +555,36 @@ gol_service_poll(void)
     while(SDL_PollEvent(&event)) {
 
         switch(event.type) {
+            case SDL_KEYDOWN:
+
+                switch(event.key.keysym.scancode) {
+                    case SDL_SCANCODE_UP:
+                        gol_service_pan(0, -gol_service_cells(g_service.view_height / 8));
+                        break;
+                    case SDL_SCANCODE_DOWN:
+                        gol_service_pan(0, gol_service_cells(g_service.view_height / 8));
+                        break;
+                    case SDL_SCANCODE_LEFT:
+                        gol_service_pan(-gol_service_cells(g_service.view_width / 8), 0);
+                        break;
+                    case SDL_SCANCODE_RIGHT:
+                        gol_service_pan(gol_service_cells(g_service.view_width / 8), 0);
+                        break;
+                    case SDL_SCANCODE_EQUALS:
+                    case SDL_SCANCODE_KP_PLUS:
+                        gol_service_zoom(1);
+                        break;
+                    case SDL_SCANCODE_MINUS:
+                    case SDL_SCANCODE_KP_MINUS:
+                        gol_service_zoom(-1);
+                        break;
+                    case SDL_SCANCODE_HOME:
+                        gol_service_fit();
+                        break;
+                    default:
+                        break;
+                }
+                break;
             case SDL_KEYUP:
 
                 if(!event.key.repeat) {
@@ -191,9 +598,42 @@ gol_service_poll(void)
                     }
                 }
                 break;
+            case SDL_MOUSEMOTION:
+
+                if(event.motion.state & SDL_BUTTON_LMASK) {
+                    int64_t cells[2];
+
+                    g_service.drag[0] += event.motion.xrel;
+                    g_service.drag[1] += event.motion.yrel;
+
+                    for(uint32_t axis = 0; axis < 2; ++axis) {
+
+                        if(g_service.zoom < 0) {
+                            cells[axis] = (int64_t)g_service.drag[axis] * (1LL << -g_service.zoom);
+                            g_service.drag[axis] = 0;
+                        } else {
+                            cells[axis] = g_service.drag[axis] / (1 << g_service.zoom);
+                            g_service.drag[axis] -= cells[axis] * (1 << g_service.zoom);
+                        }
+                    }
+
+                    if(cells[0] || cells[1]) {
+                        gol_service_pan(-cells[0], -cells[1]);
+                    }
+                }
+                break;
+            case SDL_MOUSEWHEEL:
+
+                if(event.wheel.y) {
+                    gol_service_zoom((event.wheel.y > 0) ? 1 : -1);
+                }
+                break;
             case SDL_QUIT:
                 result = false;
                 break;
+            case SDL_WINDOWEVENT:
+                g_service.stale = true;
+                break;
             default:
                 break;
         }
@@ -239,6 +679,7 @@ gol_service_uninit(void)
     }
 
     SDL_Quit();
+    gol_mipmap_uninit(&g_service.mipmap);
 
     if(g_service.pixel) {
         free(g_service.pixel);
@@ -0,0 +1,529 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "../include/snapshot.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static uint64_t
+gol_snapshot_checksum(
+    __in const uint64_t *word,
+    __in size_t count
+    )
+{
+    uint64_t sum[2][4] = {};
+    size_t index = 0;
+
+    for(; (index + 4) <= count; index += 4) {
+
+        for(uint32_t lane = 0; lane < 4; ++lane) {
+            sum[0][lane] += word[index + lane];
+            sum[1][lane] += sum[0][lane];
+        }
+    }
+
+    for(; index < count; ++index) {
+        sum[0][0] += word[index];
+        sum[1][0] += sum[0][0];
+    }
+
+    return (sum[0][0] ^ (sum[0][1] * 3) ^ (sum[0][2] * 5) ^ (sum[0][3] * 7))
+        + ((sum[1][0] ^ (sum[1][1] * 11) ^ (sum[1][2] * 13) ^ (sum[1][3] * 17)) << 1) + count;
+}
+
+static void
+gol_snapshot_band(
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t width,
+    __in size_t rows,
+    __out uint64_t *band
+    )
+{
+    size_t words = (width + WORD_BITS - 1) / WORD_BITS;
+    uint64_t mask = (width % WORD_BITS) ? (UINT64_MAX >> (WORD_BITS - (width % WORD_BITS))) : UINT64_MAX;
+
+    memset(band, 0, rows * stride * sizeof(uint64_t));
+
+    for(size_t row = 0; row < rows; ++row) {
+        const uint64_t *source = &word[row * stride];
+
+        memcpy(&band[row * stride], source, (words - 1) * sizeof(uint64_t));
+        band[(row * stride) + words - 1] = __atomic_load_n(&source[words - 1], __ATOMIC_RELAXED) & mask;
+    }
+}
+
+static int
+gol_snapshot_write(
+    __in int file,
+    __in const void *data,
+    __in size_t length,
+    __in off_t offset
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    while(length) {
+        ssize_t count;
+
+        if((count = pwrite(file, data, length, offset)) <= 0) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+
+        data = (const uint8_t *)data + count;
+        length -= count;
+        offset += count;
+    }
+
+exit:
+    return result;
+}
+
+static void *
+gol_snapshot_writer(
+    __in void *argument
+    )
+{
+    gol_snapshot_writer_t *writer = argument;
+
+    pthread_mutex_lock(&writer->lock);
+
+    for(;;) {
+        int result;
+
+        while(!writer->exit && !writer->busy) {
+            pthread_cond_wait(&writer->ready, &writer->lock);
+        }
+
+        if(!writer->busy) {
+            break;
+        }
+
+        pthread_mutex_unlock(&writer->lock);
+        result = gol_snapshot_save(writer->path, writer->frame, writer->stride, writer->width, writer->height,
+            &writer->rule, writer->generation);
+        pthread_mutex_lock(&writer->lock);
+
+        if(result != EXIT_SUCCESS) {
+            writer->result = result;
+            gol_error_save(&writer->error);
+        }
+
+        writer->busy = false;
+        pthread_cond_broadcast(&writer->ready);
+    }
+
+    pthread_mutex_unlock(&writer->lock);
+
+    return NULL;
+}
+
+void
+gol_snapshot_close(
+    __inout gol_snapshot_t *snapshot
+    )
+{
+
+    if(snapshot->mapping) {
+        munmap(snapshot->mapping, snapshot->size);
+    }
+
+    if(snapshot->verified) {
+        free(snapshot->verified);
+    }
+
+    memset(snapshot, 0, sizeof(*snapshot));
+}
+
+int
+gol_snapshot_open(
+    __inout gol_snapshot_t *snapshot,
+    __in const char *path
+    )
+{
+    int file;
+    gol_rule_t rule;
+    struct stat status;
+    size_t size, table;
+    const gol_snapshot_header_t *header;
+    uint64_t page[SNAPSHOT_OFFSET / sizeof(uint64_t)];
+    int result = EXIT_SUCCESS;
+
+    memset(snapshot, 0, sizeof(*snapshot));
+
+    if((file = open(path, O_RDONLY)) < 0) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(fstat(file, &status) || (status.st_size < SNAPSHOT_OFFSET)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if((snapshot->mapping = mmap(NULL, status.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0)) == MAP_FAILED) {
+        snapshot->mapping = NULL;
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    snapshot->size = status.st_size;
+    header = snapshot->mapping;
+    memcpy(page, header, sizeof(page));
+    ((gol_snapshot_header_t *)page)->checksum = 0;
+
+    if((header->magic != SNAPSHOT_MAGIC) || (header->version != SNAPSHOT_VERSION)
+            || (gol_snapshot_checksum(page, SNAPSHOT_OFFSET / sizeof(uint64_t)) != header->checksum)
+            || !memchr(header->rule, '\0', sizeof(header->rule))
+            || (gol_rule_parse(&rule, header->rule) != EXIT_SUCCESS)
+            || !header->width || !header->height || (header->width > (SIZE_MAX - WORD_BITS))
+            || (header->stride < ((header->width + WORD_BITS - 1) / WORD_BITS))
+            || (header->height > ((snapshot->size - SNAPSHOT_OFFSET) / sizeof(uint64_t) / header->stride
+                / gol_rule_planes(&rule)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    snapshot->width = header->width;
+    snapshot->height = header->height;
+    snapshot->stride = header->stride;
+    snapshot->generation = header->generation;
+    strcpy(snapshot->rule, header->rule);
+    snapshot->word = (uint64_t *)((uint8_t *)snapshot->mapping + SNAPSHOT_OFFSET);
+    snapshot->planes = gol_rule_planes(&rule);
+    snapshot->bands = (snapshot->height + SNAPSHOT_BAND - 1) / SNAPSHOT_BAND;
+    size = snapshot->planes * snapshot->stride * snapshot->height;
+    table = snapshot->planes * snapshot->bands;
+
+    if((((snapshot->size - SNAPSHOT_OFFSET) / sizeof(uint64_t)) - size) < table) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    snapshot->table = &snapshot->word[size];
+
+    if(gol_snapshot_checksum(snapshot->table, table) != header->table) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!(snapshot->verified = calloc(table, sizeof(uint8_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+exit:
+
+    if(file >= 0) {
+        close(file);
+    }
+
+    if(result != EXIT_SUCCESS) {
+        gol_snapshot_close(snapshot);
+    }
+
+    return result;
+}
+
+int
+gol_snapshot_save(
+    __in const char *path,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t width,
+    __in size_t height,
+    __in const gol_rule_t *rule,
+    __in uint64_t generation
+    )
+{
+    int file = -1;
+    char *temporary;
+    uint64_t *band = NULL, *table = NULL;
+    size_t planes = gol_rule_planes(rule), size = planes * stride * height;
+    size_t bands = (height + SNAPSHOT_BAND - 1) / SNAPSHOT_BAND;
+    uint64_t header[SNAPSHOT_OFFSET / sizeof(uint64_t)] = {};
+    int result = EXIT_SUCCESS;
+    gol_snapshot_header_t *value = (gol_snapshot_header_t *)header;
+
+    if(!(temporary = malloc(strlen(path) + 5))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!(table = malloc(planes * bands * sizeof(uint64_t)))
+            || !(band = malloc(SNAPSHOT_BAND * stride * sizeof(uint64_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    sprintf(temporary, "%s.tmp", path);
+
+    if((file = open(temporary, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    for(size_t plane = 0; plane < planes; ++plane) {
+
+        for(size_t index = 0; index < bands; ++index) {
+            size_t first = index * SNAPSHOT_BAND, offset = ((plane * height) + first) * stride;
+            size_t rows = ((first + SNAPSHOT_BAND) < height) ? SNAPSHOT_BAND : (height - first);
+
+            gol_snapshot_band(&word[offset], stride, width, rows, band);
+            table[(plane * bands) + index] = gol_snapshot_checksum(band, rows * stride);
+
+            if((result = gol_snapshot_write(file, band, rows * stride * sizeof(uint64_t),
+                    SNAPSHOT_OFFSET + (offset * sizeof(uint64_t)))) != EXIT_SUCCESS) {
+                goto exit;
+            }
+        }
+    }
+
+    value->magic = SNAPSHOT_MAGIC;
+    value->version = SNAPSHOT_VERSION;
+    value->width = width;
+    value->height = height;
+    value->stride = stride;
+    value->generation = generation;
+    value->table = gol_snapshot_checksum(table, planes * bands);
+    gol_rule_name(rule, value->rule, sizeof(value->rule));
+    value->checksum = gol_snapshot_checksum(header, SNAPSHOT_OFFSET / sizeof(uint64_t));
+
+    if(((result = gol_snapshot_write(file, table, planes * bands * sizeof(uint64_t),
+                SNAPSHOT_OFFSET + (size * sizeof(uint64_t)))) != EXIT_SUCCESS)
+            || ((result = gol_snapshot_write(file, header, sizeof(header), 0)) != EXIT_SUCCESS)) {
+        goto exit;
+    }
+
+    if(fdatasync(file) || rename(temporary, path)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+exit:
+
+    if(file >= 0) {
+        close(file);
+
+        if(result != EXIT_SUCCESS) {
+            unlink(temporary);
+        }
+    }
+
+    if(band) {
+        free(band);
+    }
+
+    if(table) {
+        free(table);
+    }
+
+    if(temporary) {
+        free(temporary);
+    }
+
+    return result;
+}
+
+int
+gol_snapshot_verify(
+    __inout gol_snapshot_t *snapshot,
+    __in size_t y,
+    __in size_t height
+    )
+{
+    int result = EXIT_SUCCESS;
+    size_t end = ((y + height) < snapshot->height) ? (y + height) : snapshot->height;
+
+    for(size_t plane = 0; plane < snapshot->planes; ++plane) {
+
+        for(size_t band = y / SNAPSHOT_BAND; (band * SNAPSHOT_BAND) < end; ++band) {
+            size_t index = (plane * snapshot->bands) + band, first = band * SNAPSHOT_BAND;
+            size_t rows = ((first + SNAPSHOT_BAND) < snapshot->height) ? SNAPSHOT_BAND : (snapshot->height - first);
+
+            if(snapshot->verified[index]) {
+                continue;
+            }
+
+            if(gol_snapshot_checksum(&snapshot->word[((plane * snapshot->height) + first) * snapshot->stride],
+                    rows * snapshot->stride) != snapshot->table[index]) {
+                result = GOL_ERROR(EXIT_FAILURE);
+                goto exit;
+            }
+
+            snapshot->verified[index] = true;
+        }
+    }
+
+exit:
+    return result;
+}
+
+bool
+gol_snapshot_writer_busy(
+    __inout gol_snapshot_writer_t *writer
+    )
+{
+    bool result;
+
+    pthread_mutex_lock(&writer->lock);
+    result = writer->busy;
+    pthread_mutex_unlock(&writer->lock);
+
+    return result;
+}
+
+int
+gol_snapshot_writer_init(
+    __inout gol_snapshot_writer_t *writer,
+    __in const char *path
+    )
+{
+    int result = EXIT_SUCCESS;
+
+    memset(writer, 0, sizeof(*writer));
+    writer->path = path;
+
+    if(pthread_mutex_init(&writer->lock, NULL) || pthread_cond_init(&writer->ready, NULL)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(!(writer->thread = calloc(1, sizeof(pthread_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(pthread_create(writer->thread, NULL, gol_snapshot_writer, writer)) {
+        free(writer->thread);
+        writer->thread = NULL;
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+exit:
+    return result;
+}
+
+int
+gol_snapshot_writer_post(
+    __inout gol_snapshot_writer_t *writer,
+    __in const uint64_t *word,
+    __in size_t stride,
+    __in size_t width,
+    __in size_t height,
+    __in const gol_rule_t *rule,
+    __in uint64_t generation,
+    __in bool copy
+    )
+{
+    int result;
+    size_t size = gol_rule_planes(rule) * stride * height;
+
+    pthread_mutex_lock(&writer->lock);
+
+    if((result = writer->result) != EXIT_SUCCESS) {
+        gol_error_restore(&writer->error);
+        goto exit;
+    }
+
+    if(writer->busy) {
+        goto exit;
+    }
+
+    if(copy) {
+
+        if(writer->capacity < size) {
+            uint64_t *buffer;
+
+            if(!(buffer = realloc(writer->word, size * sizeof(uint64_t)))) {
+                result = GOL_ERROR(EXIT_FAILURE);
+                goto exit;
+            }
+
+            writer->word = buffer;
+            writer->capacity = size;
+        }
+
+        pthread_mutex_unlock(&writer->lock);
+        memcpy(writer->word, word, size * sizeof(uint64_t));
+        pthread_mutex_lock(&writer->lock);
+        word = writer->word;
+    }
+
+    writer->frame = word;
+    writer->width = width;
+    writer->height = height;
+    writer->stride = stride;
+    writer->rule = *rule;
+    writer->generation = generation;
+    writer->busy = true;
+    pthread_cond_broadcast(&writer->ready);
+
+exit:
+    pthread_mutex_unlock(&writer->lock);
+
+    return result;
+}
+
+int
+gol_snapshot_writer_uninit(
+    __inout gol_snapshot_writer_t *writer
+    )
+{
+    int result = writer->result;
+
+    if(writer->thread) {
+        pthread_mutex_lock(&writer->lock);
+        writer->exit = true;
+        pthread_cond_broadcast(&writer->ready);
+        pthread_mutex_unlock(&writer->lock);
+        pthread_join(*writer->thread, NULL);
+        result = writer->result;
+        free(writer->thread);
+
+        if(result != EXIT_SUCCESS) {
+            gol_error_restore(&writer->error);
+        }
+
+        pthread_cond_destroy(&writer->ready);
+        pthread_mutex_destroy(&writer->lock);
+    }
+
+    if(writer->word) {
+        free(writer->word);
+    }
+
+    memset(writer, 0, sizeof(*writer));
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
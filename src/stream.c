@@ -0,0 +1,628 @@
+/**
+ * Game of Life (GOL)
+ * Copyright (C) 2021 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "../include/stream.h"
+
+#define STREAM_VARINT 10
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static int
+gol_stream_reserve(
+    __inout uint8_t **data,
+    __inout size_t *capacity,
+    __in size_t size
+    )
+{
+    uint8_t *resized;
+    size_t grown = *capacity ? *capacity : 4096;
+    int result = EXIT_SUCCESS;
+
+    if(size <= *capacity) {
+        goto exit;
+    }
+
+    while(grown < size) {
+        grown *= 2;
+    }
+
+    if(!(resized = realloc(*data, grown))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    *data = resized;
+    *capacity = grown;
+
+exit:
+    return result;
+}
+
+static void
+gol_stream_close(
+    __inout gol_stream_client_t *client
+    )
+{
+    close(client->socket);
+
+    if(client->pending) {
+        free(client->pending);
+    }
+
+    memset(client, 0, sizeof(*client));
+    client->socket = -1;
+}
+
+static void
+gol_stream_accept(
+    __inout gol_stream_t *stream
+    )
+{
+    int socket;
+
+    while((socket = accept(stream->listener, NULL, NULL)) >= 0) {
+        gol_stream_client_t *client = NULL;
+
+        for(uint32_t index = 0; index < STREAM_CLIENTS; ++index) {
+
+            if(stream->client[index].socket < 0) {
+                client = &stream->client[index];
+                break;
+            }
+        }
+
+        if(!client || (fcntl(socket, F_SETFL, fcntl(socket, F_GETFL) | O_NONBLOCK) < 0)) {
+            close(socket);
+            continue;
+        }
+
+        client->socket = socket;
+        client->stale = true;
+    }
+}
+
+static size_t
+gol_stream_varint(
+    __inout uint8_t *data,
+    __in uint64_t value
+    )
+{
+    size_t result = 0;
+
+    do {
+        data[result++] = (value & 0x7F) | ((value > 0x7F) ? 0x80 : 0);
+        value >>= 7;
+    } while(value);
+
+    return result;
+}
+
+static int
+gol_stream_encode(
+    __inout gol_stream_t *stream,
+    __in const gol_buffer_slot_t *slot,
+    __in gol_stream_e type
+    )
+{
+    uint64_t skip = 0;
+    gol_stream_header_t header = { .magic = STREAM_MAGIC, .version = STREAM_VERSION, .type = type,
+        .words = stream->words, .width = stream->width, .height = stream->height, .generation = slot->generation };
+    size_t length = sizeof(header);
+    int result = EXIT_SUCCESS;
+
+    for(size_t y = 0; y < stream->height; ++y) {
+        const gol_buffer_span_t *span = &slot->span[y / BUFFER_BAND];
+        const uint64_t *row = &slot->word[y * stream->stride], *shown = &stream->previous[y * stream->stride];
+        size_t begin = 0, end = stream->words;
+
+        if(type == GOL_STREAM_DELTA) {
+            begin = (span->begin < stream->words) ? span->begin : stream->words;
+            end = (span->end < stream->words) ? span->end : stream->words;
+            end = (end > begin) ? end : begin;
+        }
+
+        skip += begin;
+
+        for(size_t x = begin; x < end;) {
+            size_t count = 0;
+
+            while(((x + count) < end) && ((row[x + count] ^ ((type == GOL_STREAM_DELTA) ? shown[x + count] : 0))
+                    & (((x + count + 1) == stream->words) ? stream->mask : UINT64_MAX))) {
+                ++count;
+            }
+
+            if(!count) {
+                ++skip;
+                ++x;
+                continue;
+            }
+
+            if((result = gol_stream_reserve(&stream->message[type], &stream->capacity[type],
+                    length + (2 * STREAM_VARINT) + (count * sizeof(uint64_t)))) != EXIT_SUCCESS) {
+                goto exit;
+            }
+
+            length += gol_stream_varint(&stream->message[type][length], skip);
+            length += gol_stream_varint(&stream->message[type][length], count);
+
+            for(; count; --count, ++x) {
+                uint64_t value = row[x] ^ ((type == GOL_STREAM_DELTA) ? shown[x] : 0);
+
+                if((x + 1) == stream->words) {
+                    value &= stream->mask;
+                }
+
+                memcpy(&stream->message[type][length], &value, sizeof(value));
+                length += sizeof(value);
+            }
+
+            skip = 0;
+        }
+
+        skip += stream->words - end;
+    }
+
+    if((result = gol_stream_reserve(&stream->message[type], &stream->capacity[type], length)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    header.length = length - sizeof(header);
+    memcpy(stream->message[type], &header, sizeof(header));
+    stream->length[type] = length;
+
+exit:
+    return result;
+}
+
+static void
+gol_stream_flush(
+    __inout gol_stream_client_t *client
+    )
+{
+    ssize_t sent;
+
+    if((sent = send(client->socket, &client->pending[client->sent], client->length - client->sent,
+            MSG_DONTWAIT | MSG_NOSIGNAL)) < 0) {
+
+        if((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+            gol_stream_close(client);
+        }
+    } else if((client->sent += sent) == client->length) {
+        client->sent = 0;
+        client->length = 0;
+    }
+}
+
+static void
+gol_stream_send(
+    __inout gol_stream_client_t *client,
+    __in const uint8_t *data,
+    __in size_t length
+    )
+{
+    ssize_t sent;
+
+    if((sent = send(client->socket, data, length, MSG_DONTWAIT | MSG_NOSIGNAL)) < 0) {
+
+        if((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+            gol_stream_close(client);
+            goto exit;
+        }
+
+        sent = 0;
+    }
+
+    if((size_t)sent < length) {
+
+        if(gol_stream_reserve(&client->pending, &client->capacity, length - sent) != EXIT_SUCCESS) {
+            gol_stream_close(client);
+            goto exit;
+        }
+
+        memcpy(client->pending, &data[sent], length - sent);
+        client->length = length - sent;
+        client->sent = 0;
+    }
+
+exit:
+    return;
+}
+
+static int
+gol_stream_broadcast(
+    __inout gol_stream_t *stream,
+    __in const gol_buffer_slot_t *slot
+    )
+{
+    bool encoded[GOL_STREAM_MAX] = {};
+    gol_stream_e type = (stream->frames++ % stream->keyframe) ? GOL_STREAM_DELTA : GOL_STREAM_KEYFRAME;
+    int result = EXIT_SUCCESS;
+
+    for(uint32_t index = 0; index < STREAM_CLIENTS; ++index) {
+        gol_stream_client_t *client = &stream->client[index];
+        gol_stream_e sent = client->stale ? GOL_STREAM_KEYFRAME : type;
+
+        if(client->socket < 0) {
+            continue;
+        }
+
+        if(client->length) {
+            client->stale = true;
+            continue;
+        }
+
+        if(!encoded[sent]) {
+
+            if((result = gol_stream_encode(stream, slot, sent)) != EXIT_SUCCESS) {
+                goto exit;
+            }
+
+            encoded[sent] = true;
+        }
+
+        client->stale = false;
+        gol_stream_send(client, stream->message[sent], stream->length[sent]);
+    }
+
+    for(size_t y = 0; y < stream->height; ++y) {
+        const gol_buffer_span_t *span = &slot->span[y / BUFFER_BAND];
+
+        if(span->end > span->begin) {
+            size_t offset = (y * stream->stride) + span->begin;
+
+            memcpy(&stream->previous[offset], &slot->word[offset], (span->end - span->begin) * sizeof(uint64_t));
+        }
+    }
+
+exit:
+    return result;
+}
+
+static void
+gol_stream_receive(
+    __inout gol_stream_client_t *client
+    )
+{
+    ssize_t received;
+    uint8_t data[256];
+
+    while((received = recv(client->socket, data, sizeof(data), MSG_DONTWAIT)) > 0);
+
+    if(!received || ((errno != EAGAIN) && (errno != EWOULDBLOCK))) {
+        gol_stream_close(client);
+    }
+}
+
+static void *
+gol_stream_server(
+    __in void *argument
+    )
+{
+    gol_stream_t *stream = argument;
+    struct pollfd event[STREAM_CLIENTS + 2];
+    int result = EXIT_SUCCESS;
+
+    while(!__atomic_load_n(&stream->exit, __ATOMIC_ACQUIRE)) {
+        uint8_t wake[64];
+        const gol_buffer_slot_t *slot;
+
+        event[0] = (struct pollfd){ .fd = stream->wake[0], .events = POLLIN };
+        event[1] = (struct pollfd){ .fd = stream->listener, .events = POLLIN };
+
+        for(uint32_t index = 0; index < STREAM_CLIENTS; ++index) {
+            const gol_stream_client_t *client = &stream->client[index];
+
+            event[index + 2] = (struct pollfd){ .fd = client->socket,
+                .events = POLLIN | (client->length ? POLLOUT : 0) };
+        }
+
+        if(poll(event, STREAM_CLIENTS + 2, -1) < 0) {
+
+            if(errno == EINTR) {
+                continue;
+            }
+
+            result = GOL_ERROR(EXIT_FAILURE);
+            break;
+        }
+
+        for(uint32_t index = 0; index < STREAM_CLIENTS; ++index) {
+            gol_stream_client_t *client = &stream->client[index];
+
+            if(event[index + 2].revents & (POLLIN | POLLERR | POLLHUP)) {
+                gol_stream_receive(client);
+            }
+
+            if((client->socket >= 0) && (event[index + 2].revents & POLLOUT)) {
+                gol_stream_flush(client);
+            }
+        }
+
+        if(event[0].revents & POLLIN) {
+
+            while(read(stream->wake[0], wake, sizeof(wake)) > 0);
+
+            if((slot = gol_buffer_consume(&stream->buffer))
+                    && ((result = gol_stream_broadcast(stream, slot)) != EXIT_SUCCESS)) {
+                break;
+            }
+        }
+
+        if(event[1].revents & POLLIN) {
+            gol_stream_accept(stream);
+        }
+    }
+
+    if(result != EXIT_SUCCESS) {
+        gol_error_save(&stream->error);
+        __atomic_store_n(&stream->result, result, __ATOMIC_RELEASE);
+    }
+
+    return NULL;
+}
+
+static int
+gol_stream_listen(
+    __inout gol_stream_t *stream
+    )
+{
+    struct stat status;
+    int result = EXIT_SUCCESS;
+    size_t length = strlen(stream->path);
+    union {
+        struct sockaddr base;
+        struct sockaddr_in inet;
+        struct sockaddr_un local;
+    } address = {};
+
+    if(length && (strspn(stream->path, "0123456789") == length)) {
+        unsigned long port = strtoul(stream->path, NULL, 10);
+
+        if(!port || (port > UINT16_MAX)) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+
+        address.inet.sin_family = AF_INET;
+        address.inet.sin_port = htons(port);
+        address.inet.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        length = sizeof(address.inet);
+    } else {
+
+        if(!length || (length >= sizeof(address.local.sun_path))) {
+            result = GOL_ERROR(EXIT_FAILURE);
+            goto exit;
+        }
+
+        if(!stat(stream->path, &status) && S_ISSOCK(status.st_mode)) {
+            unlink(stream->path);
+        }
+
+        address.local.sun_family = AF_UNIX;
+        memcpy(address.local.sun_path, stream->path, length);
+        length = sizeof(address.local);
+    }
+
+    if((stream->listener = socket(address.base.sa_family, SOCK_STREAM, 0)) < 0) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(address.base.sa_family == AF_INET) {
+        int reuse = 1;
+
+        setsockopt(stream->listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    }
+
+    if(bind(stream->listener, &address.base, length)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    stream->named = (address.base.sa_family == AF_UNIX);
+
+    if(listen(stream->listener, STREAM_CLIENTS)
+            || (fcntl(stream->listener, F_SETFL, fcntl(stream->listener, F_GETFL) | O_NONBLOCK) < 0)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+exit:
+    return result;
+}
+
+int
+gol_stream_init(
+    __inout gol_stream_t *stream,
+    __in const char *path,
+    __in size_t stride,
+    __in size_t width,
+    __in size_t height,
+    __in uint64_t cadence,
+    __in uint64_t keyframe
+    )
+{
+    int result;
+
+    memset(stream, 0, sizeof(*stream));
+    stream->path = path;
+    stream->listener = -1;
+    stream->wake[0] = -1;
+    stream->wake[1] = -1;
+    stream->width = width;
+    stream->height = height;
+    stream->stride = stride;
+    stream->words = (width + WORD_BITS - 1) / WORD_BITS;
+    stream->mask = UINT64_MAX >> ((WORD_BITS - 1) - ((width - 1) & (WORD_BITS - 1)));
+    stream->cadence = cadence ? cadence : 1;
+    stream->keyframe = keyframe ? keyframe : STREAM_KEYFRAME;
+
+    for(uint32_t index = 0; index < STREAM_CLIENTS; ++index) {
+        stream->client[index].socket = -1;
+    }
+
+    if((result = gol_buffer_init(&stream->buffer, stride, height)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    if(!(stream->previous = calloc(stride * height, sizeof(uint64_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(pipe(stream->wake) || (fcntl(stream->wake[0], F_SETFL, O_NONBLOCK) < 0)
+            || (fcntl(stream->wake[1], F_SETFL, O_NONBLOCK) < 0)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if((result = gol_stream_listen(stream)) != EXIT_SUCCESS) {
+        goto exit;
+    }
+
+    if(!(stream->thread = calloc(1, sizeof(pthread_t)))) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+    if(pthread_create(stream->thread, NULL, gol_stream_server, stream)) {
+        free(stream->thread);
+        stream->thread = NULL;
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+exit:
+    return result;
+}
+
+int
+gol_stream_post(
+    __inout gol_stream_t *stream,
+    __in const uint64_t *frame,
+    __in uint64_t generation
+    )
+{
+    uint8_t wake = 0;
+    gol_buffer_slot_t *slot;
+    int result;
+
+    if((result = __atomic_load_n(&stream->result, __ATOMIC_ACQUIRE)) != EXIT_SUCCESS) {
+        gol_error_restore(&stream->error);
+        goto exit;
+    }
+
+    if((generation < stream->due) || !(slot = gol_buffer_acquire(&stream->buffer))) {
+        goto exit;
+    }
+
+    gol_buffer_write(&stream->buffer, slot, frame);
+    gol_buffer_publish(&stream->buffer, generation);
+    stream->due = generation + stream->cadence;
+
+    if((write(stream->wake[1], &wake, sizeof(wake)) < 0) && (errno != EAGAIN)) {
+        result = GOL_ERROR(EXIT_FAILURE);
+        goto exit;
+    }
+
+exit:
+    return result;
+}
+
+int
+gol_stream_uninit(
+    __inout gol_stream_t *stream
+    )
+{
+    uint8_t wake = 0;
+    int result = stream->result;
+
+    if(stream->thread) {
+        __atomic_store_n(&stream->exit, true, __ATOMIC_RELEASE);
+
+        if(write(stream->wake[1], &wake, sizeof(wake)) < 0) {
+            result = (result == EXIT_SUCCESS) ? GOL_ERROR(EXIT_FAILURE) : result;
+        }
+
+        pthread_join(*stream->thread, NULL);
+        free(stream->thread);
+
+        if((result == EXIT_SUCCESS) && ((result = stream->result) != EXIT_SUCCESS)) {
+            gol_error_restore(&stream->error);
+        }
+    }
+
+    if(stream->path) {
+
+        for(uint32_t index = 0; index < STREAM_CLIENTS; ++index) {
+
+            if(stream->client[index].socket >= 0) {
+                gol_stream_close(&stream->client[index]);
+            }
+        }
+
+        for(uint32_t index = 0; index < 2; ++index) {
+
+            if(stream->wake[index] >= 0) {
+                close(stream->wake[index]);
+            }
+        }
+
+        if(stream->listener >= 0) {
+            close(stream->listener);
+        }
+
+        if(stream->named) {
+            unlink(stream->path);
+        }
+    }
+
+    for(uint32_t index = 0; index < GOL_STREAM_MAX; ++index) {
+
+        if(stream->message[index]) {
+            free(stream->message[index]);
+        }
+    }
+
+    if(stream->previous) {
+        free(stream->previous);
+    }
+
+    gol_buffer_uninit(&stream->buffer);
+    memset(stream, 0, sizeof(*stream));
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -21,16 +21,164 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #include <gol.h>
 
+#define OPTIONS "b:B:c:d:D:e:f:g:h:i:j:k:l:L:no:p:P:r:R:s:S:t:T:w:x:y:"
+
+static const char *BOUNDARY[] = {
+    "torus",
+    "dead",
+    "mirror",
+    };
+
+static const char *ENGINE[] = {
+    "dense",
+    "hashlife",
+    "sparse",
+    };
+
+static void
+usage(
+    const char *name
+    )
+{
+    fprintf(stderr, "Usage: %s [-w WIDTH] [-h HEIGHT] [-t THREADS] [-e ENGINE] [-b RULE] [-B BOUNDARY] [-d DEPTH] [-j JUMP] [-c CACHE]"
+        " [-p PATTERN] [-x X] [-y Y] [-S SEED] [-D DENSITY] [-r RESTORE] [-s SNAPSHOT] [-i INTERVAL] [-n] [-R RATE]"
+        " [-g GENERATIONS] [-T DURATION] [-P PERIOD] [-l LOG | -L LOG] [-o STREAM] [-f CADENCE] [-k KEYFRAME]\n", name);
+}
+
 int
-main(void)
+main(
+    int argc,
+    char *argv[]
+    )
 {
-    int result;
+    int option, result = EXIT_SUCCESS;
+    gol_config_t config = { .width = 256, .height = 256 };
+
+    while((option = getopt(argc, argv, OPTIONS)) != -1) {
+
+        switch(option) {
+            case 'b':
+                config.rule = optarg;
+                break;
+            case 'B':
+
+                for(config.boundary = 0; config.boundary < GOL_BOUNDARY_MAX; ++config.boundary) {
+
+                    if(!strcmp(optarg, BOUNDARY[config.boundary])) {
+                        break;
+                    }
+                }
+
+                if(config.boundary == GOL_BOUNDARY_MAX) {
+                    usage(argv[0]);
+                    result = EXIT_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 'c':
+                config.cache = strtoul(optarg, NULL, 10);
+                break;
+            case 'd':
+                config.depth = strtoul(optarg, NULL, 10);
+                break;
+            case 'D':
+                config.density = strtod(optarg, NULL);
+                break;
+            case 'e':
+
+                for(config.engine = 0; config.engine < GOL_ENGINE_MAX; ++config.engine) {
+
+                    if(!strcmp(optarg, ENGINE[config.engine])) {
+                        break;
+                    }
+                }
+
+                if(config.engine == GOL_ENGINE_MAX) {
+                    usage(argv[0]);
+                    result = EXIT_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 'f':
+                config.cadence = strtoul(optarg, NULL, 10);
+                break;
+            case 'g':
+                config.generations = strtoul(optarg, NULL, 10);
+                break;
+            case 'h':
+                config.height = strtoul(optarg, NULL, 10);
+                break;
+            case 'i':
+                config.interval = strtoul(optarg, NULL, 10);
+                break;
+            case 'j':
+                config.jump = strtoul(optarg, NULL, 10);
+                break;
+            case 'k':
+                config.keyframe = strtoul(optarg, NULL, 10);
+                break;
+            case 'l':
+                config.log = optarg;
+                config.binary = 0;
+                break;
+            case 'L':
+                config.log = optarg;
+                config.binary = 1;
+                break;
+            case 'n':
+                config.headless = 1;
+                break;
+            case 'o':
+                config.stream = optarg;
+                break;
+            case 'p':
+                config.pattern = optarg;
+                break;
+            case 'P':
+                config.period = strtoul(optarg, NULL, 10);
+                break;
+            case 'r':
+                config.restore = optarg;
+                break;
+            case 'R':
+                config.rate = strtod(optarg, NULL);
+                break;
+            case 's':
+                config.snapshot = optarg;
+                break;
+            case 'S':
+                config.seed = strtoull(optarg, NULL, 10);
+                break;
+            case 't':
+                config.threads = strtoul(optarg, NULL, 10);
+                break;
+            case 'T':
+                config.duration = strtod(optarg, NULL);
+                break;
+            case 'w':
+                config.width = strtoul(optarg, NULL, 10);
+                break;
+            case 'x':
+                config.x = strtol(optarg, NULL, 10);
+                break;
+            case 'y':
+                config.y = strtol(optarg, NULL, 10);
+                break;
+            default:
+                usage(argv[0]);
+                result = EXIT_FAILURE;
+                goto exit;
+        }
+    }
 
-    if((result = gol(256, 256)) != EXIT_SUCCESS) {
+    if((result = gol(&config)) != EXIT_SUCCESS) {
         fprintf(stderr, "ERR: %s\n", gol_error());
     }
 
+exit:
     return result;
 }